@@ -20,7 +20,12 @@ let package = Package(
     ],
     targets: [
         .target(
-            name: "CXXRingBuffer"
+            name: "CXXRingBuffer",
+            linkerSettings: [
+                .linkedLibrary("onecore", .when(platforms: [.windows])),
+                .linkedLibrary("Synchronization", .when(platforms: [.windows])),
+                .linkedLibrary("rt", .when(platforms: [.linux])),
+            ]
         ),
         .testTarget(
             name: "CXXRingBufferTests",
@@ -0,0 +1,101 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/EventNotifier.hpp"
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// MARK: Descriptor Management
+
+bool spsc::EventNotifier::open() noexcept {
+    close();
+
+#if defined(__linux__)
+    const auto fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd == -1) {
+        return false;
+    }
+    readFD_ = fd;
+    writeFD_ = fd;
+    return true;
+#elif defined(__APPLE__)
+    int fds[2];
+    if (::pipe(fds) == -1) {
+        return false;
+    }
+    for (const auto fd : fds) {
+        if (::fcntl(fd, F_SETFL, O_NONBLOCK) == -1 || ::fcntl(fd, F_SETFD, FD_CLOEXEC) == -1) {
+            ::close(fds[0]);
+            ::close(fds[1]);
+            return false;
+        }
+    }
+    readFD_ = fds[0];
+    writeFD_ = fds[1];
+    return true;
+#else
+    return false;
+#endif
+}
+
+void spsc::EventNotifier::close() noexcept {
+#if defined(__linux__) || defined(__APPLE__)
+    if (writeFD_ != -1 && writeFD_ != readFD_) {
+        ::close(writeFD_);
+    }
+    if (readFD_ != -1) {
+        ::close(readFD_);
+    }
+#endif
+    readFD_ = -1;
+    writeFD_ = -1;
+}
+
+// MARK: Signaling
+
+void spsc::EventNotifier::signal() const noexcept {
+#if defined(__linux__)
+    // The counter only saturates after 2^64 - 2 signals, and a saturated counter is already readable
+    const std::uint64_t one = 1;
+    while (::write(writeFD_, &one, sizeof one) == -1 && errno == EINTR) {
+    }
+#elif defined(__APPLE__)
+    // A full pipe is already readable
+    const unsigned char byte = 1;
+    while (::write(writeFD_, &byte, sizeof byte) == -1 && errno == EINTR) {
+    }
+#endif
+}
+
+void spsc::EventNotifier::clear() const noexcept {
+#if defined(__linux__)
+    std::uint64_t count;
+    while (::read(readFD_, &count, sizeof count) == -1 && errno == EINTR) {
+    }
+#elif defined(__APPLE__)
+    unsigned char bytes[64];
+    for (;;) {
+        const auto result = ::read(readFD_, bytes, sizeof bytes);
+        if (result == -1 && errno == EINTR) {
+            continue;
+        }
+        if (result < static_cast<::ssize_t>(sizeof bytes)) {
+            break;
+        }
+    }
+#endif
+}
@@ -7,78 +7,591 @@
 
 #include "spsc/RingBuffer.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <memory_resource>
 #include <new>
 #include <stdexcept>
+#include <thread>
 
-// MARK: Construction and Destruction
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#include <mach/mach_vm.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
 
-spsc::RingBuffer::RingBuffer(SizeType minCapacity) {
-    if (minCapacity < RingBuffer::minCapacity || minCapacity > RingBuffer::maxCapacity) [[unlikely]] {
-        throw std::invalid_argument("capacity out of range");
+namespace {
+
+// MARK: Mirrored Memory
+
+/// Returns the granularity at which virtual memory may be mapped, or zero if mirroring is not supported.
+std::size_t mirrorGranularity() noexcept {
+#if defined(__linux__)
+    const auto pageSize = ::sysconf(_SC_PAGESIZE);
+    return pageSize > 0 ? static_cast<std::size_t>(pageSize) : 0;
+#elif defined(__APPLE__)
+    return vm_page_size;
+#elif defined(_WIN32)
+    SYSTEM_INFO systemInfo;
+    ::GetSystemInfo(&systemInfo);
+    return systemInfo.dwAllocationGranularity;
+#else
+    return 0;
+#endif
+}
+
+/// Maps size bytes of memory twice in adjacent virtual memory and returns the address of the first mapping.
+/// @param size The size of the memory to map, a multiple of mirrorGranularity().
+/// @return The address of the first mapping or nullptr on failure.
+void *mapMirrored(std::size_t size) noexcept {
+#if defined(__linux__)
+    const auto fd = ::memfd_create("spsc::RingBuffer", MFD_CLOEXEC);
+    if (fd == -1) {
+        return nullptr;
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    // Reserve address space for both mappings, then replace each half with a view of the same pages
+    auto *addr = static_cast<unsigned char *>(::mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (addr == MAP_FAILED) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    const auto mapView = [&](unsigned char *at) noexcept {
+        return ::mmap(at, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == at;
+    };
+
+    const auto mapped = mapView(addr) && mapView(addr + size);
+    ::close(fd);
+
+    if (!mapped) {
+        ::munmap(addr, 2 * size);
+        return nullptr;
+    }
+
+    return addr;
+#elif defined(__APPLE__)
+    const auto task = ::mach_task_self();
+
+    mach_vm_address_t addr = 0;
+    if (::mach_vm_allocate(task, &addr, 2 * size, VM_FLAGS_ANYWHERE) != KERN_SUCCESS) {
+        return nullptr;
+    }
+
+    // Replace the upper half with a shared view of the lower half
+    auto upper = addr + size;
+    vm_prot_t currentProtection;
+    vm_prot_t maxProtection;
+    if (::mach_vm_remap(task, &upper, size, 0, VM_FLAGS_FIXED | VM_FLAGS_OVERWRITE, task, addr, false,
+                        &currentProtection, &maxProtection, VM_INHERIT_DEFAULT) != KERN_SUCCESS ||
+        upper != addr + size) {
+        ::mach_vm_deallocate(task, addr, 2 * size);
+        return nullptr;
+    }
+
+    return reinterpret_cast<void *>(addr);
+#elif defined(_WIN32)
+    // Reserve a placeholder for both mappings and split it in two
+    auto *addr = static_cast<unsigned char *>(::VirtualAlloc2(nullptr, nullptr, 2 * size,
+                                                              MEM_RESERVE | MEM_RESERVE_PLACEHOLDER, PAGE_NOACCESS,
+                                                              nullptr, 0));
+    if (addr == nullptr) {
+        return nullptr;
+    }
+
+    if (!::VirtualFree(addr, size, MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER)) {
+        ::VirtualFree(addr, 0, MEM_RELEASE);
+        return nullptr;
+    }
+
+    const auto section = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                              static_cast<DWORD>(static_cast<std::uint64_t>(size) >> 32),
+                                              static_cast<DWORD>(size & 0xFFFFFFFF), nullptr);
+    if (section == nullptr) {
+        ::VirtualFree(addr, 0, MEM_RELEASE);
+        ::VirtualFree(addr + size, 0, MEM_RELEASE);
+        return nullptr;
+    }
+
+    auto *lower =
+            ::MapViewOfFile3(section, nullptr, addr, 0, size, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+    auto *upper = ::MapViewOfFile3(section, nullptr, addr + size, 0, size, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE,
+                                   nullptr, 0);
+    ::CloseHandle(section);
+
+    if (lower == nullptr || upper == nullptr) {
+        if (lower != nullptr) {
+            ::UnmapViewOfFile(lower);
+        } else {
+            ::VirtualFree(addr, 0, MEM_RELEASE);
+        }
+        if (upper != nullptr) {
+            ::UnmapViewOfFile(upper);
+        } else {
+            ::VirtualFree(addr + size, 0, MEM_RELEASE);
+        }
+        return nullptr;
+    }
+
+    return addr;
+#else
+    (void)size;
+    return nullptr;
+#endif
+}
+
+/// Unmaps memory mapped by mapMirrored().
+/// @param addr The address returned by mapMirrored().
+/// @param size The size passed to mapMirrored().
+void unmapMirrored(void *addr, std::size_t size) noexcept {
+#if defined(__linux__)
+    ::munmap(addr, 2 * size);
+#elif defined(__APPLE__)
+    ::mach_vm_deallocate(::mach_task_self(), reinterpret_cast<mach_vm_address_t>(addr), 2 * size);
+#elif defined(_WIN32)
+    ::UnmapViewOfFile(addr);
+    ::UnmapViewOfFile(static_cast<unsigned char *>(addr) + size);
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+// MARK: Mapped Memory
+
+using AllocationOptions = spsc::AllocationOptions;
+using HugePages = spsc::HugePages;
+
+/// Returns the size of a virtual memory page.
+std::size_t pageSize() noexcept {
+#if defined(__linux__) || defined(__APPLE__)
+    const auto pageSize = ::sysconf(_SC_PAGESIZE);
+    return pageSize > 0 ? static_cast<std::size_t>(pageSize) : 4096;
+#elif defined(_WIN32)
+    SYSTEM_INFO systemInfo;
+    ::GetSystemInfo(&systemInfo);
+    return systemInfo.dwPageSize;
+#else
+    return 4096;
+#endif
+}
+
+/// Returns the size of a huge page, or zero if huge pages are not supported.
+std::size_t hugePageSize() noexcept {
+#if defined(__linux__)
+    // The default huge page size is reported in kibibytes
+    std::size_t size = 0;
+    if (auto *file = std::fopen("/proc/meminfo", "r"); file != nullptr) {
+        char line[128];
+        unsigned long kibibytes;
+        while (std::fgets(line, sizeof line, file) != nullptr) {
+            if (std::sscanf(line, "Hugepagesize: %lu kB", &kibibytes) == 1) {
+                size = static_cast<std::size_t>(kibibytes) * 1024;
+                break;
+            }
+        }
+        std::fclose(file);
+    }
+    return size;
+#elif defined(_WIN32)
+    return ::GetLargePageMinimum();
+#else
+    return 0;
+#endif
+}
+
+/// Maps size bytes of memory directly from the system.
+/// @param size The size of the memory to map, a multiple of the page size or of the huge page size if huge pages are
+/// used.
+/// @param options The allocation options.
+/// @return The address of the mapping or nullptr on failure.
+void *mapPages(std::size_t size, const AllocationOptions &options) noexcept {
+#if defined(__linux__)
+    if (options.hugePages == HugePages::required) {
+        auto *addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        return addr != MAP_FAILED ? addr : nullptr;
+    }
+
+    // Transparent huge pages are only used for aligned ranges, so over-map and trim to an aligned address
+    const auto alignment = options.hugePages == HugePages::transparent ? hugePageSize() : 0;
+    auto *addr = static_cast<unsigned char *>(
+            ::mmap(nullptr, size + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (addr == MAP_FAILED) {
+        return nullptr;
+    }
+
+    if (alignment > 0) {
+        const auto offset = (alignment - reinterpret_cast<std::uintptr_t>(addr) % alignment) % alignment;
+        if (offset > 0) {
+            ::munmap(addr, offset);
+        }
+        if (alignment > offset) {
+            ::munmap(addr + offset + size, alignment - offset);
+        }
+        addr += offset;
+        // This is only advice, so failure is not an error
+        ::madvise(addr, size, MADV_HUGEPAGE);
+    }
+
+    return addr;
+#elif defined(__APPLE__)
+    if (options.hugePages == HugePages::required) {
+        return nullptr;
+    }
+    auto *addr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    return addr != MAP_FAILED ? addr : nullptr;
+#elif defined(_WIN32)
+    DWORD type = MEM_RESERVE | MEM_COMMIT;
+    if (options.hugePages == HugePages::required) {
+        type |= MEM_LARGE_PAGES;
     }
-    if (!allocate(minCapacity)) [[unlikely]] {
-        throw std::bad_alloc();
+    const auto node = options.numaNode >= 0 ? static_cast<DWORD>(options.numaNode) : NUMA_NO_PREFERRED_NODE;
+    return ::VirtualAllocExNuma(::GetCurrentProcess(), nullptr, size, type, PAGE_READWRITE, node);
+#else
+    (void)size;
+    (void)options;
+    return nullptr;
+#endif
+}
+
+/// Unmaps memory mapped by mapPages().
+/// @param addr The address returned by mapPages().
+/// @param size The size passed to mapPages().
+void unmapPages(void *addr, std::size_t size) noexcept {
+#if defined(__linux__) || defined(__APPLE__)
+    ::munmap(addr, size);
+#elif defined(_WIN32)
+    (void)size;
+    ::VirtualFree(addr, 0, MEM_RELEASE);
+#else
+    (void)addr;
+    (void)size;
+#endif
+}
+
+/// Sets the memory policy of size bytes at addr to allocate pages only from node.
+/// @note Pages that have already been touched are not moved.
+/// @return true on success, false if NUMA binding is not supported or failed.
+bool bindToNode(void *addr, std::size_t size, int node) noexcept {
+#if defined(__linux__)
+    constexpr auto bitsPerWord = static_cast<std::size_t>(std::numeric_limits<unsigned long>::digits);
+    constexpr auto maxNode = 1024;
+    if (node >= maxNode) {
+        return false;
     }
+
+    unsigned long nodeMask[maxNode / bitsPerWord]{};
+    nodeMask[static_cast<std::size_t>(node) / bitsPerWord] = 1UL << (static_cast<std::size_t>(node) % bitsPerWord);
+    // The kernel reads one bit fewer than maxnode
+    return ::syscall(SYS_mbind, addr, size, MPOL_BIND, nodeMask, maxNode + 1, MPOL_MF_STRICT) == 0;
+#else
+    (void)addr;
+    (void)size;
+    (void)node;
+    return false;
+#endif
 }
 
-spsc::RingBuffer::RingBuffer(RingBuffer &&other) noexcept
+/// Locks size bytes at addr in physical memory until they are unmapped.
+/// @return true on success, false if locking is not supported or failed.
+bool lockPages(void *addr, std::size_t size) noexcept {
+#if defined(__linux__) || defined(__APPLE__)
+    return ::mlock(addr, size) == 0;
+#elif defined(_WIN32)
+    return ::VirtualLock(addr, size) != 0;
+#else
+    (void)addr;
+    (void)size;
+    return false;
+#endif
+}
+
+/// Touches every page of size bytes at addr so later accesses do not fault.
+void prefaultPages(void *addr, std::size_t size) noexcept {
+    // The buffer's contents are unspecified so writing zeroes is harmless
+    auto *bytes = static_cast<volatile unsigned char *>(addr);
+    const auto stride = pageSize();
+    for (std::size_t offset = 0; offset < size; offset += stride) {
+        bytes[offset] = 0;
+    }
+}
+
+/// Releases a buffer allocated by spsc::detail::RingStorage::allocate() from the heap or by mapping pages.
+/// @tparam Backing spsc::detail::RingStorage's private enumeration of buffer origins.
+template <typename Backing> void freeSystemBuffer(void *buffer, std::size_t capacity, Backing backing) noexcept {
+    switch (backing) {
+    case Backing::heap:
+        std::free(buffer);
+        break;
+    case Backing::mapped:
+        unmapPages(buffer, capacity);
+        break;
+    case Backing::mirrored:
+        unmapMirrored(buffer, capacity);
+        break;
+    case Backing::resource:
+    case Backing::adopted:
+        break;
+    }
+}
+
+/// Releases a buffer owned by spsc::detail::RingStorage.
+/// @tparam Backing spsc::detail::RingStorage's private enumeration of buffer origins.
+template <typename Backing>
+void freeBuffer(void *buffer, std::size_t capacity, Backing backing, std::pmr::memory_resource *resource) noexcept {
+    if (backing == Backing::resource) {
+        resource->deallocate(buffer, capacity, spsc::cacheLineSize);
+    } else {
+        freeSystemBuffer(buffer, capacity, backing);
+    }
+}
+
+// MARK: Waiting
+
+#if defined(__APPLE__)
+// These are provided by libSystem but not declared in a public header
+extern "C" int __ulock_wait(std::uint32_t operation, void *addr, std::uint64_t value, std::uint32_t timeout);
+extern "C" int __ulock_wake(std::uint32_t operation, void *addr, std::uint64_t wakeValue);
+
+constexpr std::uint32_t UL_COMPARE_AND_WAIT = 1;
+constexpr std::uint32_t UL_COMPARE_AND_WAIT_SHARED = 3;
+constexpr std::uint32_t ULF_NO_ERRNO = 0x01000000;
+#endif
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) &&
+                      std::atomic<std::uint32_t>::is_always_lock_free,
+              "Waiting on the address of std::atomic<std::uint32_t> requires it to be a plain 32-bit word");
+
+} /* namespace */
+
+void spsc::detail::waitOnAddress(std::atomic<std::uint32_t> &word, std::uint32_t expected,
+                                 const std::chrono::nanoseconds *timeout, bool shared) noexcept {
+#if defined(__linux__)
+    timespec ts{};
+    if (timeout != nullptr) {
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(*timeout);
+        ts.tv_sec = static_cast<time_t>(seconds.count());
+        ts.tv_nsec = static_cast<long>((*timeout - seconds).count());
+    }
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, expected,
+              timeout != nullptr ? &ts : nullptr, nullptr, 0);
+#elif defined(__APPLE__)
+    // A timeout of zero waits indefinitely, so round up to at least one microsecond
+    std::uint32_t microseconds = 0;
+    if (timeout != nullptr) {
+        const auto count = std::chrono::ceil<std::chrono::microseconds>(*timeout).count();
+        microseconds = static_cast<std::uint32_t>(std::clamp<decltype(count)>(count, 1, UINT32_MAX));
+    }
+    __ulock_wait((shared ? UL_COMPARE_AND_WAIT_SHARED : UL_COMPARE_AND_WAIT) | ULF_NO_ERRNO, &word, expected,
+                 microseconds);
+#elif defined(_WIN32)
+    (void)shared;
+    DWORD milliseconds = INFINITE;
+    if (timeout != nullptr) {
+        const auto count = std::chrono::ceil<std::chrono::milliseconds>(*timeout).count();
+        milliseconds = static_cast<DWORD>(std::clamp<decltype(count)>(count, 0, INFINITE - 1));
+    }
+    ::WaitOnAddress(&word, &expected, sizeof expected, milliseconds);
+#else
+    (void)shared;
+    if (timeout != nullptr) {
+        // Without a timed wait primitive poll at a coarse interval
+        std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(*timeout, std::chrono::milliseconds{1}));
+    } else {
+        word.wait(expected, std::memory_order_relaxed);
+    }
+#endif
+}
+
+void spsc::detail::wakeAddress(std::atomic<std::uint32_t> &word, bool shared) noexcept {
+#if defined(__linux__)
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, 1, nullptr,
+              nullptr, 0);
+#elif defined(__APPLE__)
+    __ulock_wake((shared ? UL_COMPARE_AND_WAIT_SHARED : UL_COMPARE_AND_WAIT) | ULF_NO_ERRNO, &word, 0);
+#elif defined(_WIN32)
+    (void)shared;
+    ::WakeByAddressSingle(&word);
+#else
+    (void)shared;
+    word.notify_one();
+#endif
+}
+
+// MARK: Copying
+
+void spsc::detail::copyLarge(unsigned char *dst, const unsigned char *src, std::size_t size, CopyMode mode) noexcept {
+    if (mode == CopyMode::standard || size < largeCopyThreshold) [[likely]] {
+        std::memcpy(dst, src, size);
+    } else if (mode == CopyMode::streaming) {
+        copyStreaming(dst, src, size);
+    } else {
+        copyPrefetching(dst, src, size);
+    }
+}
+
+// MARK: Storage
+
+spsc::detail::RingStorage::RingStorage(RingStorage &&other) noexcept
     : buffer_{std::exchange(other.buffer_, nullptr)}, capacity_{std::exchange(other.capacity_, 0)},
-      capacityMask_{std::exchange(other.capacityMask_, 0)},
-      writePosition_{other.writePosition_.exchange(0, std::memory_order_relaxed)},
-      readPosition_{other.readPosition_.exchange(0, std::memory_order_relaxed)} {}
+      capacityMask_{std::exchange(other.capacityMask_, 0)}, extent_{std::exchange(other.extent_, 0)},
+      backing_{std::exchange(other.backing_, Backing::heap)}, resource_{std::exchange(other.resource_, nullptr)} {}
 
-auto spsc::RingBuffer::operator=(RingBuffer &&other) noexcept -> RingBuffer & {
+auto spsc::detail::RingStorage::operator=(RingStorage &&other) noexcept -> RingStorage & {
     if (this != &other) [[likely]] {
-        std::free(buffer_);
+        if (buffer_ != nullptr) {
+            freeBuffer(buffer_, capacity_, backing_, resource_);
+        }
 
         buffer_ = std::exchange(other.buffer_, nullptr);
         capacity_ = std::exchange(other.capacity_, 0);
         capacityMask_ = std::exchange(other.capacityMask_, 0);
-
-        writePosition_.store(other.writePosition_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
-        readPosition_.store(other.readPosition_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        extent_ = std::exchange(other.extent_, 0);
+        backing_ = std::exchange(other.backing_, Backing::heap);
+        resource_ = std::exchange(other.resource_, nullptr);
     }
     return *this;
 }
 
-spsc::RingBuffer::~RingBuffer() noexcept { std::free(buffer_); }
-
-// MARK: Buffer Management
+spsc::detail::RingStorage::~RingStorage() noexcept {
+    if (buffer_ != nullptr) {
+        freeBuffer(buffer_, capacity_, backing_, resource_);
+    }
+}
 
-bool spsc::RingBuffer::allocate(SizeType minCapacity) noexcept {
-    if (minCapacity < RingBuffer::minCapacity || minCapacity > RingBuffer::maxCapacity) [[unlikely]] {
+bool spsc::detail::RingStorage::allocate(std::size_t minCapacity, const AllocationOptions &options) noexcept {
+    if (options.mirrored && options.hugePages != HugePages::none) [[unlikely]] {
         return false;
     }
 
-    deallocate();
+    auto capacity = std::bit_ceil(minCapacity);
+    auto extent = capacity;
+    auto backing = Backing::heap;
+    void *buffer = nullptr;
 
-    const auto capacity = std::bit_ceil(minCapacity);
-    buffer_ = std::malloc(capacity);
+    if (options.mirrored) {
+        // The granularity is a power of two so the rounded capacity remains one
+        const auto granularity = mirrorGranularity();
+        if (granularity == 0 || !std::has_single_bit(granularity)) [[unlikely]] {
+            return false;
+        }
+
+        capacity = std::max(capacity, granularity);
+        if (capacity > RingBuffer::maxCapacity / 2) [[unlikely]] {
+            return false;
+        }
+
+        extent = 2 * capacity;
+        backing = Backing::mirrored;
+        buffer = mapMirrored(capacity);
+    } else if (options.hugePages != HugePages::none || options.numaNode >= 0 || options.locked) {
+        // Huge page and page sizes are powers of two so the rounded capacity remains one
+        const auto granularity = options.hugePages != HugePages::none ? hugePageSize() : pageSize();
+        if (granularity == 0 || !std::has_single_bit(granularity)) [[unlikely]] {
+            return false;
+        }
+
+        capacity = std::max(capacity, granularity);
+        extent = capacity;
+        backing = Backing::mapped;
+        buffer = mapPages(capacity, options);
+    } else {
+        buffer = std::malloc(capacity);
+    }
+
+    if (buffer == nullptr) [[unlikely]] {
+        return false;
+    }
 
-    if (buffer_ == nullptr) [[unlikely]] {
+    // Pages must be bound before they are first touched; on Windows the node is chosen when mapping
+#if defined(_WIN32)
+    const auto bound = options.numaNode < 0 || backing == Backing::mapped;
+#else
+    const auto bound = options.numaNode < 0 || bindToNode(buffer, capacity, options.numaNode);
+#endif
+    if (!bound || (options.locked && !lockPages(buffer, extent))) [[unlikely]] {
+        freeSystemBuffer(buffer, capacity, backing);
         return false;
     }
 
+    if (options.prefault) {
+        prefaultPages(buffer, extent);
+    }
+
+    buffer_ = buffer;
     capacity_ = capacity;
     capacityMask_ = capacity - 1;
-
-    writePosition_.store(0, std::memory_order_relaxed);
-    readPosition_.store(0, std::memory_order_relaxed);
+    extent_ = extent;
+    backing_ = backing;
 
     return true;
 }
 
-void spsc::RingBuffer::deallocate() noexcept {
-    if (buffer_ != nullptr) [[likely]] {
-        std::free(buffer_);
+bool spsc::detail::RingStorage::allocate(std::size_t minCapacity, std::pmr::memory_resource &resource) noexcept {
+    const auto capacity = std::bit_ceil(minCapacity);
+    void *buffer = nullptr;
+    try {
+        buffer = resource.allocate(capacity, cacheLineSize);
+    } catch (...) {
+        return false;
+    }
 
-        buffer_ = nullptr;
-        capacity_ = 0;
-        capacityMask_ = 0;
+    buffer_ = buffer;
+    capacity_ = capacity;
+    capacityMask_ = capacity - 1;
+    extent_ = capacity;
+    backing_ = Backing::resource;
+    resource_ = &resource;
 
-        writePosition_.store(0, std::memory_order_relaxed);
-        readPosition_.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+void spsc::detail::RingStorage::adopt(std::span<unsigned char> region) noexcept {
+    buffer_ = region.data();
+    capacity_ = region.size();
+    capacityMask_ = region.size() - 1;
+    extent_ = region.size();
+    backing_ = Backing::adopted;
+}
+
+bool spsc::detail::RingStorage::deallocate() noexcept {
+    if (buffer_ == nullptr) {
+        return false;
     }
+
+    freeBuffer(buffer_, capacity_, backing_, resource_);
+
+    buffer_ = nullptr;
+    capacity_ = 0;
+    capacityMask_ = 0;
+    extent_ = 0;
+    backing_ = Backing::heap;
+    resource_ = nullptr;
+
+    return true;
 }
@@ -0,0 +1,208 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/SharedRingBuffer.hpp"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <new>
+
+#if defined(__linux__) || defined(__APPLE__)
+#define RB_HAS_SHARED_MEMORY
+#include <cerrno>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#if defined(RB_HAS_SHARED_MEMORY)
+/// Returns true if the process identified by pid exists.
+bool isProcessAlive(std::int64_t pid) noexcept {
+    return pid > 0 && (::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM);
+}
+#endif
+
+} /* namespace */
+
+// MARK: Attaching
+
+bool spsc::SharedRingBuffer::create(const char *const name, SizeType minCapacity, Role role) noexcept {
+#if defined(RB_HAS_SHARED_MEMORY)
+    if (name == nullptr || minCapacity < Ring::minCapacity || minCapacity > Ring::maxCapacity) [[unlikely]] {
+        return false;
+    }
+
+    const auto fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd == -1) {
+        return false;
+    }
+
+    const auto attached = attach(fd, minCapacity, role);
+    ::close(fd);
+
+    if (!attached) {
+        ::shm_unlink(name);
+    }
+    return attached;
+#else
+    (void)name;
+    (void)minCapacity;
+    (void)role;
+    return false;
+#endif
+}
+
+bool spsc::SharedRingBuffer::open(const char *const name, Role role) noexcept {
+#if defined(RB_HAS_SHARED_MEMORY)
+    if (name == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    const auto fd = ::shm_open(name, O_RDWR, 0);
+    if (fd == -1) {
+        return false;
+    }
+
+    const auto attached = attach(fd, 0, role);
+    ::close(fd);
+    return attached;
+#else
+    (void)name;
+    (void)role;
+    return false;
+#endif
+}
+
+bool spsc::SharedRingBuffer::create(int fd, SizeType minCapacity, Role role) noexcept {
+    if (minCapacity < Ring::minCapacity || minCapacity > Ring::maxCapacity) [[unlikely]] {
+        return false;
+    }
+    return attach(fd, minCapacity, role);
+}
+
+bool spsc::SharedRingBuffer::open(int fd, Role role) noexcept { return attach(fd, 0, role); }
+
+bool spsc::SharedRingBuffer::remove(const char *const name) noexcept {
+#if defined(RB_HAS_SHARED_MEMORY)
+    return name != nullptr && ::shm_unlink(name) == 0;
+#else
+    (void)name;
+    return false;
+#endif
+}
+
+void spsc::SharedRingBuffer::close() noexcept {
+#if defined(RB_HAS_SHARED_MEMORY)
+    if (ring_ != nullptr) {
+        // Give up the role only if a process that found this one dead has not taken it over
+        auto pid = static_cast<std::int64_t>(::getpid());
+        ring_->holder(role_).compare_exchange_strong(pid, 0, std::memory_order_release, std::memory_order_relaxed);
+
+        ::munmap(ring_, mappingSize_);
+        ring_ = nullptr;
+        mappingSize_ = 0;
+    }
+#endif
+}
+
+// MARK: Peer Status
+
+bool spsc::SharedRingBuffer::isPeerAlive() const noexcept {
+#if defined(RB_HAS_SHARED_MEMORY)
+    if (ring_ == nullptr) [[unlikely]] {
+        return false;
+    }
+    const auto peer = role_ == Role::producer ? Role::consumer : Role::producer;
+    return isProcessAlive(ring_->holder(peer).load(std::memory_order_acquire));
+#else
+    return false;
+#endif
+}
+
+// MARK: Mapping
+
+bool spsc::SharedRingBuffer::attach(int fd, SizeType minCapacity, Role role) noexcept {
+#if defined(RB_HAS_SHARED_MEMORY)
+    if (fd < 0) [[unlikely]] {
+        return false;
+    }
+
+    close();
+
+    const auto creating = minCapacity != 0;
+    SizeType mappingSize;
+
+    if (creating) {
+        const auto capacity = std::bit_ceil(minCapacity);
+        mappingSize = sizeof(Ring) + capacity;
+        if (::ftruncate(fd, static_cast<off_t>(mappingSize)) != 0) {
+            return false;
+        }
+    } else {
+        struct stat status;
+        if (::fstat(fd, &status) != 0 || static_cast<SizeType>(status.st_size) < sizeof(Ring)) {
+            return false;
+        }
+        mappingSize = static_cast<SizeType>(status.st_size);
+    }
+
+    auto *addr = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    Ring *ring;
+    if (creating) {
+        ring = new (addr) Ring(mappingSize - sizeof(Ring));
+        // Publish the initialized control block to processes that open it
+        ring->magic_.store(magic, std::memory_order_release);
+    } else {
+        ring = std::launder(static_cast<Ring *>(addr));
+        // The remainder of the control block is only initialized once the magic number is visible
+        if (ring->magic_.load(std::memory_order_acquire) != magic) {
+            ::munmap(addr, mappingSize);
+            return false;
+        }
+        const auto capacity = ring->capacity_;
+        if (ring->version_ != version || ring->controlSize_ != sizeof(Ring) || capacity < Ring::minCapacity ||
+            !std::has_single_bit(capacity) || capacity != mappingSize - sizeof(Ring)) {
+            ::munmap(addr, mappingSize);
+            return false;
+        }
+    }
+
+    // Take the role if it is free or its holder has died. A role this process already holds is refused, since closing
+    // either attachment would release the role the other is still using.
+    auto &holder = ring->holder(role);
+    const auto pid = static_cast<std::int64_t>(::getpid());
+    auto current = holder.load(std::memory_order_acquire);
+    for (;;) {
+        if (current != 0 && (current == pid || isProcessAlive(current))) {
+            ::munmap(addr, mappingSize);
+            return false;
+        }
+        if (holder.compare_exchange_weak(current, pid, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            break;
+        }
+    }
+
+    ring_ = ring;
+    mappingSize_ = mappingSize;
+    role_ = role;
+    return true;
+#else
+    (void)fd;
+    (void)minCapacity;
+    (void)role;
+    return false;
+#endif
+}
@@ -0,0 +1,450 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef MPSC_RING_BUFFER_HPP
+#define MPSC_RING_BUFFER_HPP
+
+#include "spsc/RingBuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace mpsc {
+
+using spsc::ByteCopyable;
+using spsc::cacheLineSize;
+using spsc::ValueLike;
+
+/// A lock-free MPSC ring buffer of variable-length records.
+///
+/// This class is thread safe when used with any number of producers and a single consumer.
+///
+/// Producers claim space for a record by advancing a shared reservation position with compare-and-swap, copy the
+/// record in, and then publish it by setting a committed flag in the record's header. The consumer reads records in
+/// reservation order and stops at the first one that has not been committed, so it only ever observes fully written
+/// records. Like ``spsc::MessageRing`` a record never wraps around the end of the buffer so payloads are contiguous.
+///
+/// The consumer zeroes the space occupied by records it releases so that stale bytes are never mistaken for a
+/// committed header.
+class RingBuffer final {
+  public:
+    /// Unsigned integer type.
+    using SizeType = std::size_t;
+    /// Atomic unsigned integer type.
+    using AtomicSizeType = std::atomic<SizeType>;
+
+    /// The size of a record header in bytes.
+    static constexpr auto headerSize = SizeType{sizeof(std::uint64_t)};
+    /// The alignment of record headers and payloads in the ring buffer.
+    static constexpr auto recordAlignment = headerSize;
+
+    /// The minimum supported ring buffer capacity in bytes.
+    static constexpr auto minCapacity = SizeType{4 * headerSize};
+    /// The maximum supported ring buffer capacity in bytes.
+    static constexpr auto maxCapacity = SizeType{1} << (std::numeric_limits<SizeType>::digits - 1);
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty ring buffer.
+    /// @note ``allocate`` must be called before the object may be used.
+    RingBuffer() noexcept = default;
+
+    /// Creates a ring buffer with the specified minimum capacity.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
+    /// supported.
+    explicit RingBuffer(SizeType minCapacity);
+
+    RingBuffer(const RingBuffer &) = delete;
+    RingBuffer &operator=(const RingBuffer &) = delete;
+
+    /// Creates a ring buffer by moving the contents of another ring buffer.
+    /// @note This method is not thread safe for the ring buffer being moved.
+    /// @param other The ring buffer to move.
+    RingBuffer(RingBuffer &&other) noexcept;
+
+    /// Moves the contents of another ring buffer into this ring buffer.
+    /// @note This method is not thread safe.
+    /// @param other The ring buffer to move.
+    RingBuffer &operator=(RingBuffer &&other) noexcept;
+
+    /// Destroys the ring buffer and releases all associated resources.
+    ~RingBuffer() noexcept;
+
+    // MARK: Buffer Management
+
+    /// Allocates space for records.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @note This method is not thread safe.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @return true on success, false if memory could not be allocated or the buffer capacity is not supported.
+    bool allocate(SizeType minCapacity) noexcept [[clang::allocating]];
+
+    /// Frees any space allocated for records.
+    /// @note This method is not thread safe.
+    void deallocate() noexcept;
+
+    // MARK: Buffer Information
+
+    /// Returns true if the ring buffer has space for records.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the capacity of the ring buffer.
+    /// @note This method is safe to call from producers and consumer.
+    /// @return The ring buffer capacity in bytes, including space used by headers and padding.
+    [[nodiscard]] SizeType capacity() const noexcept [[clang::nonblocking]];
+
+    /// Returns the size of the largest record that can be written.
+    ///
+    /// A record of this size always fits once the consumer has released all earlier records.
+    /// @note This method is safe to call from producers and consumer.
+    /// @return The maximum payload size in bytes.
+    [[nodiscard]] SizeType maxRecordSize() const noexcept [[clang::nonblocking]];
+
+    /// Returns true if no records have been reserved beyond those returned by ``readRecord()``.
+    /// @note The result of this method is only accurate when called from the consumer.
+    /// @return true if no records are available or pending for reading.
+    [[nodiscard]] bool isEmpty() const noexcept [[clang::nonblocking]];
+
+    // MARK: Writing
+
+    /// Reserves space for a record to be written in place.
+    ///
+    /// The record is not visible to the consumer until it is passed to ``commit()``. Records reserved later by other
+    /// producers are not visible until this record is committed, so a reservation should be committed promptly.
+    /// @note This method is safe to call from any producer.
+    /// @param size The size of the payload in bytes.
+    /// @return A std::optional containing a contiguous span to receive the payload if sufficient free space is
+    /// available.
+    [[nodiscard]] std::optional<std::span<unsigned char>> reserve(SizeType size) noexcept [[clang::nonblocking]];
+
+    /// Makes a reserved record visible to the consumer.
+    /// @warning The behavior is undefined if record was not returned by ``reserve()`` or has already been committed.
+    /// @note This method is safe to call from any producer.
+    /// @param record The span returned by ``reserve()``.
+    void commit(std::span<unsigned char> record) noexcept [[clang::nonblocking]];
+
+    /// Writes a record.
+    /// @note This method is safe to call from any producer.
+    /// @param ptr An address containing the payload to copy.
+    /// @param size The size of the payload in bytes.
+    /// @return true if the record was written, false if insufficient free space is available.
+    bool write(const void *const RB_NULLABLE ptr, SizeType size) noexcept [[clang::nonblocking]];
+
+    /// Writes a record.
+    /// @note This method is safe to call from any producer.
+    /// @tparam T The type of the payload items.
+    /// @param payload A span containing the payload to copy.
+    /// @return true if the record was written, false if insufficient free space is available.
+    template <ByteCopyable T> bool write(std::span<const T> payload) noexcept [[clang::nonblocking]];
+
+    /// Writes a value as a record.
+    /// @note This method is safe to call from any producer.
+    /// @param value The value to write.
+    /// @return true if the record was written, false if insufficient free space is available.
+    bool write(ValueLike auto const &value) noexcept [[clang::nonblocking]];
+
+    // MARK: Reading
+
+    /// Returns the next committed record without copying it.
+    ///
+    /// The payload remains valid until ``commitRead()`` is called. Records may be read repeatedly before they are
+    /// released together.
+    /// @note This method is only safe to call from the consumer.
+    /// @return A std::optional containing a contiguous span of the payload if a committed record is available.
+    [[nodiscard]] std::optional<std::span<const unsigned char>> readRecord() noexcept [[clang::nonblocking]];
+
+    /// Returns the space occupied by all records returned by ``readRecord()`` to the producers.
+    /// @note This method is only safe to call from the consumer.
+    void commitRead() noexcept [[clang::nonblocking]];
+
+  private:
+    /// Set in a header once its record may be read.
+    static constexpr auto committedFlag = std::uint64_t{1} << 63;
+    /// Set in a header whose record fills the remainder of the buffer.
+    static constexpr auto paddingFlag = std::uint64_t{1} << 62;
+    /// The bits of a header containing the payload size.
+    static constexpr auto sizeMask = std::uint64_t{std::numeric_limits<std::uint32_t>::max()};
+
+    /// The memory buffer holding the records.
+    unsigned char *RB_NULLABLE buffer_{nullptr};
+    /// The capacity of buffer_ in bytes.
+    SizeType capacity_{0};
+    /// The capacity of buffer_ in bytes minus one.
+    SizeType capacityMask_{0};
+
+    /// The free-running position following the most recent reservation.
+    alignas(cacheLineSize) AtomicSizeType reservePosition_{0};
+
+    /// The free-running read location.
+    alignas(cacheLineSize) AtomicSizeType readPosition_{0};
+    /// The number of bytes read by the consumer but not yet released.
+    SizeType pendingBytes_{0};
+
+    /// Returns the number of bytes occupied by a record with a payload of size bytes.
+    [[nodiscard]] static constexpr SizeType recordSize(SizeType size) noexcept [[clang::nonblocking]];
+
+    /// Returns the header of the record at position.
+    [[nodiscard]] std::atomic_ref<std::uint64_t> header(SizeType position) const noexcept [[clang::nonblocking]];
+
+    static_assert(AtomicSizeType::is_always_lock_free, "Lock-free AtomicSizeType required");
+    static_assert(std::atomic_ref<std::uint64_t>::required_alignment <= recordAlignment,
+                  "Record headers must be suitably aligned for std::atomic_ref");
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+inline RingBuffer::RingBuffer(SizeType minCapacity) {
+    if (minCapacity < RingBuffer::minCapacity || minCapacity > RingBuffer::maxCapacity) [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
+    if (!allocate(minCapacity)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
+
+inline RingBuffer::RingBuffer(RingBuffer &&other) noexcept
+    : buffer_{std::exchange(other.buffer_, nullptr)}, capacity_{std::exchange(other.capacity_, 0)},
+      capacityMask_{std::exchange(other.capacityMask_, 0)},
+      reservePosition_{other.reservePosition_.exchange(0, std::memory_order_relaxed)},
+      readPosition_{other.readPosition_.exchange(0, std::memory_order_relaxed)},
+      pendingBytes_{std::exchange(other.pendingBytes_, 0)} {}
+
+inline auto RingBuffer::operator=(RingBuffer &&other) noexcept -> RingBuffer & {
+    if (this != &other) [[likely]] {
+        deallocate();
+
+        buffer_ = std::exchange(other.buffer_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        capacityMask_ = std::exchange(other.capacityMask_, 0);
+
+        reservePosition_.store(other.reservePosition_.exchange(0, std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+        readPosition_.store(other.readPosition_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        pendingBytes_ = std::exchange(other.pendingBytes_, 0);
+    }
+    return *this;
+}
+
+inline RingBuffer::~RingBuffer() noexcept { deallocate(); }
+
+// MARK: Buffer Management
+
+inline bool RingBuffer::allocate(SizeType minCapacity) noexcept {
+    if (minCapacity < RingBuffer::minCapacity || minCapacity > RingBuffer::maxCapacity) [[unlikely]] {
+        return false;
+    }
+
+    deallocate();
+
+    const auto capacity = std::bit_ceil(minCapacity);
+    auto *buffer = static_cast<unsigned char *>(
+            ::operator new(capacity, std::align_val_t{std::max(cacheLineSize, recordAlignment)}, std::nothrow));
+    if (buffer == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    // Every header starts out uncommitted
+    std::memset(buffer, 0, capacity);
+
+    buffer_ = buffer;
+    capacity_ = capacity;
+    capacityMask_ = capacity - 1;
+
+    reservePosition_.store(0, std::memory_order_relaxed);
+    readPosition_.store(0, std::memory_order_relaxed);
+    pendingBytes_ = 0;
+
+    return true;
+}
+
+inline void RingBuffer::deallocate() noexcept {
+    if (buffer_ != nullptr) [[likely]] {
+        ::operator delete(buffer_, std::align_val_t{std::max(cacheLineSize, recordAlignment)});
+
+        buffer_ = nullptr;
+        capacity_ = 0;
+        capacityMask_ = 0;
+
+        reservePosition_.store(0, std::memory_order_relaxed);
+        readPosition_.store(0, std::memory_order_relaxed);
+        pendingBytes_ = 0;
+    }
+}
+
+// MARK: Buffer Information
+
+inline RingBuffer::operator bool() const noexcept { return buffer_ != nullptr; }
+
+inline auto RingBuffer::capacity() const noexcept -> SizeType { return capacity_; }
+
+inline auto RingBuffer::maxRecordSize() const noexcept -> SizeType {
+    if (buffer_ == nullptr) [[unlikely]] {
+        return 0;
+    }
+    // A record must fit in whichever side of the reservation position is larger
+    return std::min(capacity_ / 2 - headerSize, SizeType{sizeMask});
+}
+
+inline bool RingBuffer::isEmpty() const noexcept {
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    return reservePosition_.load(std::memory_order_acquire) == readPos + pendingBytes_;
+}
+
+// MARK: Writing
+
+inline auto RingBuffer::reserve(SizeType size) noexcept -> std::optional<std::span<unsigned char>> {
+    if (size > maxRecordSize()) [[unlikely]] {
+        return std::nullopt;
+    }
+
+    const auto recordBytes = recordSize(size);
+    auto reservePos = reservePosition_.load(std::memory_order_relaxed);
+    SizeType paddingBytes;
+
+    for (;;) {
+        const auto bytesToEnd = capacity_ - (reservePos & capacityMask_);
+        paddingBytes = recordBytes <= bytesToEnd ? 0 : bytesToEnd;
+
+        // Observing the read position also makes the consumer's zeroing of released space visible
+        const auto readPos = readPosition_.load(std::memory_order_acquire);
+        if (capacity_ - (reservePos - readPos) < paddingBytes + recordBytes) {
+            // A stale reservation position may underflow the subtraction above, so only fail on a current one
+            if (const auto currentPos = reservePosition_.load(std::memory_order_relaxed); currentPos == reservePos) {
+                return std::nullopt;
+            } else {
+                reservePos = currentPos;
+                continue;
+            }
+        }
+
+        if (reservePosition_.compare_exchange_weak(reservePos, reservePos + paddingBytes + recordBytes,
+                                                   std::memory_order_relaxed, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    if (paddingBytes > 0) {
+        header(reservePos).store(committedFlag | paddingFlag, std::memory_order_release);
+    }
+
+    auto *record = buffer_ + ((reservePos + paddingBytes) & capacityMask_);
+    return std::span{record + headerSize, size};
+}
+
+inline void RingBuffer::commit(std::span<unsigned char> record) noexcept {
+    const auto position = static_cast<SizeType>(record.data() - headerSize - buffer_);
+    header(position).store(committedFlag | record.size(), std::memory_order_release);
+}
+
+inline bool RingBuffer::write(const void *const RB_NULLABLE ptr, SizeType size) noexcept {
+    if (ptr == nullptr && size > 0) [[unlikely]] {
+        return false;
+    }
+
+    const auto record = reserve(size);
+    if (!record) {
+        return false;
+    }
+
+    if (size > 0) [[likely]] {
+        std::memcpy(record->data(), ptr, size);
+    }
+    commit(*record);
+    return true;
+}
+
+template <ByteCopyable T> inline bool RingBuffer::write(std::span<const T> payload) noexcept {
+    return write(payload.data(), payload.size_bytes());
+}
+
+inline bool RingBuffer::write(ValueLike auto const &value) noexcept {
+    return write(static_cast<const void *>(std::addressof(value)), sizeof value);
+}
+
+// MARK: Reading
+
+inline auto RingBuffer::readRecord() noexcept -> std::optional<std::span<const unsigned char>> {
+    if (buffer_ == nullptr) [[unlikely]] {
+        return std::nullopt;
+    }
+
+    for (;;) {
+        // Once every byte is pending the next header is the oldest unreleased one, which has not yet been zeroed
+        if (pendingBytes_ == capacity_) {
+            return std::nullopt;
+        }
+
+        const auto position = readPosition_.load(std::memory_order_relaxed) + pendingBytes_;
+        const auto value = header(position).load(std::memory_order_acquire);
+        if ((value & committedFlag) == 0) {
+            return std::nullopt;
+        }
+
+        const auto index = position & capacityMask_;
+        if ((value & paddingFlag) != 0) {
+            pendingBytes_ += capacity_ - index;
+            continue;
+        }
+
+        const auto size = static_cast<SizeType>(value & sizeMask);
+        pendingBytes_ += recordSize(size);
+        return std::span<const unsigned char>{buffer_ + index + headerSize, size};
+    }
+}
+
+inline void RingBuffer::commitRead() noexcept {
+    if (pendingBytes_ == 0) {
+        return;
+    }
+
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    const auto readIndex = readPos & capacityMask_;
+    const auto bytesToEnd = capacity_ - readIndex;
+
+    if (pendingBytes_ <= bytesToEnd) [[likely]] {
+        std::memset(buffer_ + readIndex, 0, pendingBytes_);
+    } else [[unlikely]] {
+        std::memset(buffer_ + readIndex, 0, bytesToEnd);
+        std::memset(buffer_, 0, pendingBytes_ - bytesToEnd);
+    }
+
+    readPosition_.store(readPos + std::exchange(pendingBytes_, 0), std::memory_order_release);
+}
+
+// MARK: Records
+
+constexpr auto RingBuffer::recordSize(SizeType size) noexcept -> SizeType {
+    return (headerSize + size + recordAlignment - 1) & ~(recordAlignment - 1);
+}
+
+inline auto RingBuffer::header(SizeType position) const noexcept -> std::atomic_ref<std::uint64_t> {
+    // Headers are only accessed atomically while the space they occupy is reserved
+    return std::atomic_ref{*std::launder(reinterpret_cast<std::uint64_t *>(buffer_ + (position & capacityMask_)))};
+}
+
+} /* namespace mpsc */
+
+#endif
@@ -0,0 +1,673 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPMC_RING_BUFFER_HPP
+#define SPMC_RING_BUFFER_HPP
+
+#include "spsc/RingBuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace spmc {
+
+using spsc::ByteCopyable;
+using spsc::cacheLineSize;
+using spsc::ValueLike;
+
+/// A lock-free broadcast ring buffer with a single producer and multiple readers.
+///
+/// Data written once by the producer is seen by every reader. Each reader has its own read position on a separate
+/// cache line and reads through a ``Reader`` handle obtained from ``addReader()``.
+///
+/// A ``ReaderMode::blocking`` reader is never overrun: the free space available to the producer is determined by the
+/// slowest blocking reader. A ``ReaderMode::lossy`` reader does not hold back the producer; when it falls more than
+/// the ring buffer capacity behind, the oldest unread data is discarded and the number of bytes lost is reported by
+/// ``Reader::missedBytes()``.
+///
+/// Lossy readers detect overwrites in the manner of a sequence lock: the producer announces the extent of the space
+/// it is about to write before writing it, and a lossy reader checks the announcement after copying data out.
+class RingBuffer final {
+  public:
+    /// Unsigned integer type.
+    using SizeType = std::size_t;
+    /// Atomic unsigned integer type.
+    using AtomicSizeType = std::atomic<SizeType>;
+
+    /// A write vector.
+    using WriteVector = std::pair<std::span<unsigned char>, std::span<unsigned char>>;
+    /// A read vector.
+    using ReadVector = std::pair<std::span<const unsigned char>, std::span<const unsigned char>>;
+
+    /// The minimum supported ring buffer capacity in bytes.
+    static constexpr auto minCapacity = SizeType{2};
+    /// The maximum supported ring buffer capacity in bytes.
+    static constexpr auto maxCapacity = SizeType{1} << (std::numeric_limits<SizeType>::digits - 1);
+
+    /// How a reader interacts with the producer.
+    enum class ReaderMode : std::uint8_t {
+        /// The producer waits for the reader before overwriting unread data.
+        blocking = 1,
+        /// The producer overwrites unread data and the reader skips what it missed.
+        lossy = 2,
+    };
+
+    class Reader;
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty ring buffer.
+    /// @note ``allocate`` must be called before the object may be used.
+    RingBuffer() noexcept = default;
+
+    /// Creates a ring buffer with the specified minimum capacity and number of reader slots.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param maxReaders The maximum number of readers that may be registered at once.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity or
+    /// reader count is not supported.
+    RingBuffer(SizeType minCapacity, SizeType maxReaders);
+
+    // Readers refer to the ring buffer by address
+    RingBuffer(const RingBuffer &) = delete;
+    RingBuffer &operator=(const RingBuffer &) = delete;
+    RingBuffer(RingBuffer &&) = delete;
+    RingBuffer &operator=(RingBuffer &&) = delete;
+
+    /// Destroys the ring buffer and releases all associated resources.
+    /// @warning The behavior is undefined if any readers are registered.
+    ~RingBuffer() noexcept;
+
+    // MARK: Buffer Management
+
+    /// Allocates space for data and reader positions.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @note This method is not thread safe.
+    /// @warning The behavior is undefined if any readers are registered.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param maxReaders The maximum number of readers that may be registered at once.
+    /// @return true on success, false if memory could not be allocated or the buffer capacity or reader count is not
+    /// supported.
+    bool allocate(SizeType minCapacity, SizeType maxReaders) noexcept [[clang::allocating]];
+
+    /// Frees any space allocated for data and reader positions.
+    /// @note This method is not thread safe.
+    /// @warning The behavior is undefined if any readers are registered.
+    void deallocate() noexcept;
+
+    // MARK: Buffer Information
+
+    /// Returns true if the ring buffer has allocated space for data.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the capacity of the ring buffer.
+    /// @return The ring buffer capacity in bytes.
+    [[nodiscard]] SizeType capacity() const noexcept [[clang::nonblocking]];
+
+    /// Returns the maximum number of readers that may be registered at once.
+    [[nodiscard]] SizeType maxReaders() const noexcept [[clang::nonblocking]];
+
+    // MARK: Readers
+
+    /// Registers a reader.
+    ///
+    /// The reader starts at the current write position and sees only data written after it was added.
+    /// @note This method is only safe to call from the producer.
+    /// @param mode How the reader interacts with the producer.
+    /// @return A std::optional containing the reader if a reader slot is available.
+    [[nodiscard]] std::optional<Reader> addReader(ReaderMode mode = ReaderMode::blocking) noexcept
+            [[clang::nonblocking]];
+
+    // MARK: Buffer Usage
+
+    /// Returns the amount of free space in the ring buffer.
+    ///
+    /// Free space is limited by the slowest blocking reader. If no blocking readers are registered the entire
+    /// capacity is free.
+    /// @note This method is only safe to call from the producer.
+    /// @return The number of bytes of free space.
+    [[nodiscard]] SizeType freeSpace() const noexcept [[clang::nonblocking]];
+
+    // MARK: Writing
+
+    /// Writes data and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @param ptr An address containing the data to copy.
+    /// @param itemSize The size of an individual item in bytes.
+    /// @param itemCount The desired number of items to write.
+    /// @param allowPartial Whether any items should be written if insufficient free space is available to write all
+    /// items.
+    /// @return The number of items actually written.
+    SizeType write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, bool allowPartial) noexcept
+            [[clang::nonblocking]];
+
+    /// Writes items and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam T The type to write.
+    /// @param data A span containing the items to copy.
+    /// @param allowPartial Whether any items should be written if insufficient free space is available to write all
+    /// items.
+    /// @return The number of items actually written.
+    template <ByteCopyable T>
+    SizeType write(std::span<const T> data, bool allowPartial = true) noexcept [[clang::nonblocking]];
+
+    /// Writes a value and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @param value The value to write.
+    /// @return true if value was successfully written.
+    bool write(ValueLike auto const &value) noexcept [[clang::nonblocking]];
+
+    /// Returns a write vector containing at most count bytes of the current writable space.
+    ///
+    /// Unlike ``spsc::RingBuffer::writeVector()`` the result is limited to count bytes, because lossy readers treat
+    /// all of the returned space as overwritten.
+    /// @note This method is only safe to call from the producer.
+    /// @param count The maximum number of bytes of writable space to return.
+    /// @return A pair of spans containing the writable space.
+    [[nodiscard]] WriteVector writeVector(SizeType count) noexcept [[clang::nonblocking]];
+
+    /// Finalizes a write transaction by publishing staged data to the readers.
+    /// @warning The behavior is undefined if count is greater than the size of the write vector.
+    /// @note This method is only safe to call from the producer.
+    /// @param count The number of bytes that were successfully written to the write vector.
+    void commitWrite(SizeType count) noexcept [[clang::nonblocking]];
+
+  private:
+    /// The read position and registration state of a reader.
+    struct alignas(cacheLineSize) Cursor {
+        /// The free-running read location of the reader.
+        AtomicSizeType position{0};
+        /// The reader's mode cast to an integer, or zero if the slot is unused.
+        std::atomic<std::uint8_t> mode{0};
+    };
+
+    /// The memory buffer holding the data.
+    unsigned char *RB_NULLABLE buffer_{nullptr};
+    /// The capacity of buffer_ in bytes.
+    SizeType capacity_{0};
+    /// The capacity of buffer_ in bytes minus one.
+    SizeType capacityMask_{0};
+    /// The reader slots.
+    Cursor *RB_NULLABLE cursors_{nullptr};
+    /// The number of reader slots.
+    SizeType maxReaders_{0};
+
+    /// The free-running write location.
+    alignas(cacheLineSize) AtomicSizeType writePosition_{0};
+    /// The free-running position following the last byte the producer may have modified.
+    AtomicSizeType claimPosition_{0};
+    /// Cached read position of the slowest blocking reader.
+    mutable SizeType cachedReadPosition_{0};
+
+    /// Returns the number of bytes the producer may write, reloading reader positions if fewer than count are known
+    /// to be free.
+    [[nodiscard]] SizeType writableBytes(SizeType writePos, SizeType count) const noexcept [[clang::nonblocking]];
+
+    /// Returns the read position of the slowest blocking reader, or writePos if there are none.
+    [[nodiscard]] SizeType slowestReadPosition(SizeType writePos) const noexcept [[clang::nonblocking]];
+
+    /// Announces to lossy readers that the space before end may be modified.
+    void claim(SizeType writePos, SizeType end) noexcept [[clang::nonblocking]];
+
+    static_assert(AtomicSizeType::is_always_lock_free, "Lock-free AtomicSizeType required");
+};
+
+/// A handle through which one thread reads from a broadcast ring buffer.
+///
+/// The reader's slot is released when the handle is destroyed.
+class RingBuffer::Reader final {
+  public:
+    /// Creates an empty reader.
+    Reader() noexcept = default;
+
+    Reader(const Reader &) = delete;
+    Reader &operator=(const Reader &) = delete;
+
+    /// Creates a reader by moving another reader.
+    /// @param other The reader to move.
+    Reader(Reader &&other) noexcept;
+
+    /// Releases this reader's slot and moves another reader into it.
+    /// @param other The reader to move.
+    Reader &operator=(Reader &&other) noexcept;
+
+    /// Releases the reader's slot.
+    ~Reader() noexcept;
+
+    // MARK: Reader Information
+
+    /// Returns true if the reader is registered with a ring buffer.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the reader's mode.
+    [[nodiscard]] ReaderMode mode() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of bytes a lossy reader has lost to overwrites.
+    [[nodiscard]] SizeType missedBytes() const noexcept [[clang::nonblocking]];
+
+    /// Returns the amount of data available to the reader.
+    /// @return The number of bytes available for reading.
+    [[nodiscard]] SizeType availableBytes() noexcept [[clang::nonblocking]];
+
+    // MARK: Reading
+
+    /// Reads data and advances the read position.
+    /// @param ptr An address to receive the data.
+    /// @param itemSize The size of an individual item in bytes.
+    /// @param itemCount The desired number of items to read.
+    /// @param allowPartial Whether any items should be read if the number of items available to read is less than
+    /// itemCount.
+    /// @return The number of items actually read.
+    SizeType read(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, bool allowPartial) noexcept
+            [[clang::nonblocking]];
+
+    /// Reads items and advances the read position.
+    /// @tparam T The type to read.
+    /// @param buffer A span to receive the items.
+    /// @param allowPartial Whether any items should be read if the number of items available to read is less than
+    /// buffer.size().
+    /// @return The number of items actually read.
+    template <ByteCopyable T>
+    SizeType read(std::span<T> buffer, bool allowPartial = true) noexcept [[clang::nonblocking]];
+
+    /// Reads a value and advances the read position.
+    /// @param value The destination value.
+    /// @return true on success, false otherwise.
+    bool read(ValueLike auto &value) noexcept [[clang::nonblocking]];
+
+    /// Returns a read vector containing the data available to the reader.
+    ///
+    /// For a lossy reader the data may be overwritten while it is being examined; ``commitRead()`` reports whether
+    /// that happened.
+    /// @return A pair of spans containing the readable data.
+    [[nodiscard]] ReadVector readVector() noexcept [[clang::nonblocking]];
+
+    /// Finalizes a read transaction by advancing the read position.
+    /// @warning The behavior is undefined if count is greater than the size of the read vector.
+    /// @param count The number of bytes that were consumed from the read vector.
+    /// @return true on success, or false if a lossy reader was overrun while reading, in which case the data in the
+    /// read vector must be discarded and the read position has moved to the oldest intact data.
+    [[nodiscard]] bool commitRead(SizeType count) noexcept [[clang::nonblocking]];
+
+  private:
+    friend class RingBuffer;
+
+    /// Creates a reader occupying cursor.
+    Reader(RingBuffer &ring, Cursor &cursor, ReaderMode mode, SizeType position) noexcept;
+
+    /// Moves a lossy reader's position past any data that has been overwritten.
+    void skipOverwritten(SizeType claimPos) noexcept [[clang::nonblocking]];
+
+    /// The ring buffer being read.
+    RingBuffer *RB_NULLABLE ring_{nullptr};
+    /// The reader's slot.
+    Cursor *RB_NULLABLE cursor_{nullptr};
+    /// The reader's mode.
+    ReaderMode mode_{ReaderMode::blocking};
+    /// The free-running read location, mirrored to cursor_.
+    SizeType position_{0};
+    /// The number of bytes lost to overwrites.
+    SizeType missedBytes_{0};
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+inline RingBuffer::RingBuffer(SizeType minCapacity, SizeType maxReaders) {
+    if (minCapacity < RingBuffer::minCapacity || minCapacity > RingBuffer::maxCapacity || maxReaders == 0)
+            [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
+    if (!allocate(minCapacity, maxReaders)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
+
+inline RingBuffer::~RingBuffer() noexcept { deallocate(); }
+
+// MARK: Buffer Management
+
+inline bool RingBuffer::allocate(SizeType minCapacity, SizeType maxReaders) noexcept {
+    if (minCapacity < RingBuffer::minCapacity || minCapacity > RingBuffer::maxCapacity || maxReaders == 0)
+            [[unlikely]] {
+        return false;
+    }
+
+    deallocate();
+
+    const auto capacity = std::bit_ceil(minCapacity);
+    auto *buffer =
+            static_cast<unsigned char *>(::operator new(capacity, std::align_val_t{cacheLineSize}, std::nothrow));
+    if (buffer == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    auto *cursors = new (std::nothrow) Cursor[maxReaders];
+    if (cursors == nullptr) [[unlikely]] {
+        ::operator delete(buffer, std::align_val_t{cacheLineSize});
+        return false;
+    }
+
+    buffer_ = buffer;
+    capacity_ = capacity;
+    capacityMask_ = capacity - 1;
+    cursors_ = cursors;
+    maxReaders_ = maxReaders;
+
+    writePosition_.store(0, std::memory_order_relaxed);
+    claimPosition_.store(0, std::memory_order_relaxed);
+    cachedReadPosition_ = 0;
+
+    return true;
+}
+
+inline void RingBuffer::deallocate() noexcept {
+    if (buffer_ != nullptr) [[likely]] {
+        ::operator delete(buffer_, std::align_val_t{cacheLineSize});
+        delete[] cursors_;
+
+        buffer_ = nullptr;
+        capacity_ = 0;
+        capacityMask_ = 0;
+        cursors_ = nullptr;
+        maxReaders_ = 0;
+
+        writePosition_.store(0, std::memory_order_relaxed);
+        claimPosition_.store(0, std::memory_order_relaxed);
+        cachedReadPosition_ = 0;
+    }
+}
+
+// MARK: Buffer Information
+
+inline RingBuffer::operator bool() const noexcept { return buffer_ != nullptr; }
+
+inline auto RingBuffer::capacity() const noexcept -> SizeType { return capacity_; }
+
+inline auto RingBuffer::maxReaders() const noexcept -> SizeType { return maxReaders_; }
+
+// MARK: Readers
+
+inline auto RingBuffer::addReader(ReaderMode mode) noexcept -> std::optional<Reader> {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    for (SizeType i = 0; i < maxReaders_; ++i) {
+        auto &cursor = cursors_[i];
+        if (cursor.mode.load(std::memory_order_acquire) == 0) {
+            // The new reader is not behind the cached slowest position so the producer's cache remains valid
+            cursor.position.store(writePos, std::memory_order_relaxed);
+            cursor.mode.store(static_cast<std::uint8_t>(mode), std::memory_order_release);
+            return Reader{*this, cursor, mode, writePos};
+        }
+    }
+    return std::nullopt;
+}
+
+// MARK: Buffer Usage
+
+inline auto RingBuffer::freeSpace() const noexcept -> SizeType {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    return writableBytes(writePos, capacity_);
+}
+
+// MARK: Writing
+
+inline auto RingBuffer::write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                              bool allowPartial) noexcept -> SizeType {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity_ == 0) [[unlikely]] {
+        return 0;
+    }
+
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto bytesRequested = itemCount > capacity_ / itemSize ? capacity_ : itemSize * itemCount;
+    const auto itemsFree = writableBytes(writePos, bytesRequested) / itemSize;
+
+    if (itemsFree == 0 || (itemsFree < itemCount && !allowPartial)) {
+        return 0;
+    }
+
+    const auto itemsToWrite = std::min(itemsFree, itemCount);
+    const auto bytesToWrite = itemsToWrite * itemSize;
+    claim(writePos, writePos + bytesToWrite);
+
+    const auto *src = static_cast<const unsigned char *>(ptr);
+    const auto writeIndex = writePos & capacityMask_;
+    const auto bytesToEnd = capacity_ - writeIndex;
+
+    if (bytesToWrite <= bytesToEnd) [[likely]] {
+        std::memcpy(buffer_ + writeIndex, src, bytesToWrite);
+    } else [[unlikely]] {
+        std::memcpy(buffer_ + writeIndex, src, bytesToEnd);
+        std::memcpy(buffer_, src + bytesToEnd, bytesToWrite - bytesToEnd);
+    }
+
+    writePosition_.store(writePos + bytesToWrite, std::memory_order_release);
+    return itemsToWrite;
+}
+
+template <ByteCopyable T>
+inline auto RingBuffer::write(std::span<const T> data, bool allowPartial) noexcept -> SizeType {
+    return write(data.data(), sizeof(T), data.size(), allowPartial);
+}
+
+inline bool RingBuffer::write(ValueLike auto const &value) noexcept {
+    return write(static_cast<const void *>(std::addressof(value)), sizeof value, 1, false) == 1;
+}
+
+inline auto RingBuffer::writeVector(SizeType count) noexcept -> WriteVector {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto bytesFree = std::min(writableBytes(writePos, count), count);
+
+    if (bytesFree == 0) [[unlikely]] {
+        return {};
+    }
+
+    claim(writePos, writePos + bytesFree);
+
+    const auto writeIndex = writePos & capacityMask_;
+    const auto bytesToEnd = capacity_ - writeIndex;
+
+    if (bytesFree > bytesToEnd) [[unlikely]] {
+        return {{buffer_ + writeIndex, bytesToEnd}, {buffer_, bytesFree - bytesToEnd}};
+    }
+    return {{buffer_ + writeIndex, bytesFree}, {}};
+}
+
+inline void RingBuffer::commitWrite(SizeType count) noexcept {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    writePosition_.store(writePos + count, std::memory_order_release);
+}
+
+// MARK: Producer Helpers
+
+inline auto RingBuffer::writableBytes(SizeType writePos, SizeType count) const noexcept -> SizeType {
+    if (const auto bytesFree = capacity_ - (writePos - cachedReadPosition_); bytesFree >= count) {
+        return bytesFree;
+    }
+    cachedReadPosition_ = slowestReadPosition(writePos);
+    return capacity_ - (writePos - cachedReadPosition_);
+}
+
+inline auto RingBuffer::slowestReadPosition(SizeType writePos) const noexcept -> SizeType {
+    auto slowest = writePos;
+    for (SizeType i = 0; i < maxReaders_; ++i) {
+        const auto &cursor = cursors_[i];
+        if (cursor.mode.load(std::memory_order_acquire) != static_cast<std::uint8_t>(ReaderMode::blocking)) {
+            continue;
+        }
+        // Positions are free-running so compare distances behind the write position
+        const auto readPos = cursor.position.load(std::memory_order_acquire);
+        if (writePos - readPos > writePos - slowest) {
+            slowest = readPos;
+        }
+    }
+    return slowest;
+}
+
+inline void RingBuffer::claim(SizeType writePos, SizeType end) noexcept {
+    // The claim never moves backwards, since space handed out but not committed may already have been modified
+    if (end - writePos > claimPosition_.load(std::memory_order_relaxed) - writePos) {
+        claimPosition_.store(end, std::memory_order_relaxed);
+        // Order the announcement before the data is modified
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+}
+
+// MARK: Reader
+
+inline RingBuffer::Reader::Reader(RingBuffer &ring, Cursor &cursor, ReaderMode mode, SizeType position) noexcept
+    : ring_{&ring}, cursor_{&cursor}, mode_{mode}, position_{position} {}
+
+inline RingBuffer::Reader::Reader(Reader &&other) noexcept
+    : ring_{std::exchange(other.ring_, nullptr)}, cursor_{std::exchange(other.cursor_, nullptr)}, mode_{other.mode_},
+      position_{other.position_}, missedBytes_{std::exchange(other.missedBytes_, 0)} {}
+
+inline auto RingBuffer::Reader::operator=(Reader &&other) noexcept -> Reader & {
+    if (this != &other) [[likely]] {
+        if (cursor_ != nullptr) {
+            cursor_->mode.store(0, std::memory_order_release);
+        }
+        ring_ = std::exchange(other.ring_, nullptr);
+        cursor_ = std::exchange(other.cursor_, nullptr);
+        mode_ = other.mode_;
+        position_ = other.position_;
+        missedBytes_ = std::exchange(other.missedBytes_, 0);
+    }
+    return *this;
+}
+
+inline RingBuffer::Reader::~Reader() noexcept {
+    if (cursor_ != nullptr) {
+        cursor_->mode.store(0, std::memory_order_release);
+    }
+}
+
+inline RingBuffer::Reader::operator bool() const noexcept { return ring_ != nullptr; }
+
+inline auto RingBuffer::Reader::mode() const noexcept -> ReaderMode { return mode_; }
+
+inline auto RingBuffer::Reader::missedBytes() const noexcept -> SizeType { return missedBytes_; }
+
+inline auto RingBuffer::Reader::availableBytes() noexcept -> SizeType {
+    if (ring_ == nullptr) [[unlikely]] {
+        return 0;
+    }
+    if (mode_ == ReaderMode::lossy) {
+        // Loading the claim first guarantees the write position is not behind the skipped-to position
+        skipOverwritten(ring_->claimPosition_.load(std::memory_order_acquire));
+    }
+    // A lossy reader may fall more than the capacity behind if the producer moves on after the claim is loaded.
+    // Copying is limited to the buffer and the check of the claim in commitRead detects the overwrite.
+    return std::min(ring_->writePosition_.load(std::memory_order_acquire) - position_, ring_->capacity_);
+}
+
+inline auto RingBuffer::Reader::read(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                     bool allowPartial) noexcept -> SizeType {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || ring_ == nullptr) [[unlikely]] {
+        return 0;
+    }
+
+    for (;;) {
+        const auto [front, back] = readVector();
+        const auto itemsAvailable = (front.size() + back.size()) / itemSize;
+
+        if (itemsAvailable == 0 || (itemsAvailable < itemCount && !allowPartial)) {
+            return 0;
+        }
+
+        const auto itemsToRead = std::min(itemsAvailable, itemCount);
+        const auto bytesToRead = itemsToRead * itemSize;
+        auto *dst = static_cast<unsigned char *>(ptr);
+
+        if (bytesToRead <= front.size()) [[likely]] {
+            std::memcpy(dst, front.data(), bytesToRead);
+        } else [[unlikely]] {
+            std::memcpy(dst, front.data(), front.size());
+            std::memcpy(dst + front.size(), back.data(), bytesToRead - front.size());
+        }
+
+        if (commitRead(bytesToRead)) [[likely]] {
+            return itemsToRead;
+        }
+    }
+}
+
+template <ByteCopyable T>
+inline auto RingBuffer::Reader::read(std::span<T> buffer, bool allowPartial) noexcept -> SizeType {
+    return read(buffer.data(), sizeof(T), buffer.size(), allowPartial);
+}
+
+inline bool RingBuffer::Reader::read(ValueLike auto &value) noexcept {
+    return read(std::addressof(value), sizeof value, 1, false) == 1;
+}
+
+inline auto RingBuffer::Reader::readVector() noexcept -> ReadVector {
+    if (ring_ == nullptr) [[unlikely]] {
+        return {};
+    }
+
+    const auto bytesAvailable = availableBytes();
+    if (bytesAvailable == 0) [[unlikely]] {
+        return {};
+    }
+
+    const auto *src = ring_->buffer_;
+    const auto readIndex = position_ & ring_->capacityMask_;
+    const auto bytesToEnd = ring_->capacity_ - readIndex;
+
+    if (bytesAvailable > bytesToEnd) [[unlikely]] {
+        return {{src + readIndex, bytesToEnd}, {src, bytesAvailable - bytesToEnd}};
+    }
+    return {{src + readIndex, bytesAvailable}, {}};
+}
+
+inline bool RingBuffer::Reader::commitRead(SizeType count) noexcept {
+    if (ring_ == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    if (mode_ == ReaderMode::lossy) {
+        // Order the preceding reads of the data before checking whether the producer has announced overwriting it
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (const auto claimPos = ring_->claimPosition_.load(std::memory_order_relaxed);
+            claimPos - position_ > ring_->capacity_) [[unlikely]] {
+            skipOverwritten(claimPos);
+            return false;
+        }
+    }
+
+    position_ += count;
+    cursor_->position.store(position_, std::memory_order_release);
+    return true;
+}
+
+inline void RingBuffer::Reader::skipOverwritten(SizeType claimPos) noexcept {
+    if (const auto oldest = claimPos - ring_->capacity_; claimPos - position_ > ring_->capacity_) {
+        missedBytes_ += oldest - position_;
+        position_ = oldest;
+        cursor_->position.store(position_, std::memory_order_relaxed);
+    }
+}
+
+} /* namespace spmc */
+
+#endif
@@ -0,0 +1,311 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_BLOCK_POOL_HPP
+#define SPSC_BLOCK_POOL_HPP
+
+#include "spsc/RingBuffer.hpp"
+#include "spsc/TypedRingBuffer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace spsc {
+
+/// A lock-free SPSC pool of preallocated blocks passed between a producer and a consumer by index.
+///
+/// This class is thread safe when used with a single producer and a single consumer.
+///
+/// The producer acquires a free block, fills it in place, and submits it; the consumer receives the block, processes
+/// it in place, and releases it. Only the 4-byte index of a block travels through the two internal ring buffers, one
+/// carrying filled blocks to the consumer and one returning free blocks to the producer, so the cost of a handoff
+/// does not depend on the block size. Each index is in at most one ring buffer at a time and each ring buffer holds
+/// every index, so submitting and releasing never fail.
+///
+/// Blocks are allocated contiguously and each begins on its own cache line.
+/// @tparam T The element type of the blocks.
+template <ByteCopyable T = unsigned char> class BlockPool final {
+  public:
+    /// The element type.
+    using ValueType = T;
+    /// Unsigned integer type.
+    using SizeType = std::size_t;
+    /// The type of a block index.
+    using IndexType = std::uint32_t;
+
+    /// A block and the elements it contains.
+    struct Block {
+        /// The index of the block in the pool.
+        IndexType index;
+        /// The elements of the block: its full capacity when acquired, or the elements submitted when received.
+        std::span<T> data;
+    };
+
+    /// The maximum supported number of blocks.
+    static constexpr auto maxBlockCount = SizeType{std::numeric_limits<IndexType>::max()};
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty block pool.
+    /// @note ``allocate`` must be called before the object may be used.
+    BlockPool() noexcept = default;
+
+    /// Creates a block pool with the specified number of blocks.
+    /// @param blockCount The number of blocks.
+    /// @param blockSize The capacity of each block in elements.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the block count or block size
+    /// is not supported.
+    BlockPool(SizeType blockCount, SizeType blockSize);
+
+    BlockPool(const BlockPool &) = delete;
+    BlockPool &operator=(const BlockPool &) = delete;
+
+    /// Creates a block pool by moving the contents of another block pool.
+    /// @note This method is not thread safe for the block pool being moved.
+    /// @param other The block pool to move.
+    BlockPool(BlockPool &&other) noexcept;
+
+    /// Moves the contents of another block pool into this block pool.
+    /// @note This method is not thread safe.
+    /// @param other The block pool to move.
+    BlockPool &operator=(BlockPool &&other) noexcept;
+
+    /// Destroys the block pool and releases all associated resources.
+    ~BlockPool() noexcept;
+
+    // MARK: Pool Management
+
+    /// Allocates blocks, discarding any existing blocks.
+    ///
+    /// All blocks are initially free.
+    /// @note This method is not thread safe.
+    /// @param blockCount The number of blocks.
+    /// @param blockSize The capacity of each block in elements.
+    /// @return true on success, false if memory could not be allocated or the block count or block size is not
+    /// supported.
+    bool allocate(SizeType blockCount, SizeType blockSize) noexcept [[clang::allocating]];
+
+    /// Frees all blocks.
+    /// @note This method is not thread safe.
+    void deallocate() noexcept;
+
+    // MARK: Pool Information
+
+    /// Returns true if the pool has blocks.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of blocks in the pool.
+    [[nodiscard]] SizeType blockCount() const noexcept [[clang::nonblocking]];
+
+    /// Returns the capacity of each block.
+    /// @return The block capacity in elements.
+    [[nodiscard]] SizeType blockSize() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of blocks that may be acquired.
+    /// @note The result of this method is only accurate when called from the producer.
+    [[nodiscard]] SizeType freeBlocks() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of blocks that may be received.
+    /// @note The result of this method is only accurate when called from the consumer.
+    [[nodiscard]] SizeType filledBlocks() const noexcept [[clang::nonblocking]];
+
+    // MARK: Producing
+
+    /// Takes a free block for filling.
+    /// @note This method is only safe to call from the producer.
+    /// @return The block spanning its full capacity, or std::nullopt if every block is in use.
+    [[nodiscard]] std::optional<Block> acquire() noexcept [[clang::nonblocking]];
+
+    /// Passes a filled block to the consumer.
+    /// @note This method is only safe to call from the producer.
+    /// @param index The index of a block returned by ``acquire``.
+    /// @param count The number of elements filled, limited to the block size.
+    void submit(IndexType index, SizeType count) noexcept [[clang::nonblocking]];
+
+    // MARK: Consuming
+
+    /// Takes the oldest filled block.
+    /// @note This method is only safe to call from the consumer.
+    /// @note The block remains valid until it is released.
+    /// @return The block spanning the elements submitted, or std::nullopt if no block has been submitted.
+    [[nodiscard]] std::optional<Block> receive() noexcept [[clang::nonblocking]];
+
+    /// Returns a block to the producer.
+    /// @note This method is only safe to call from the consumer.
+    /// @param index The index of a block returned by ``receive``.
+    void release(IndexType index) noexcept [[clang::nonblocking]];
+
+  private:
+    /// The alignment of each block.
+    static constexpr auto blockAlignment = std::max(alignof(T), cacheLineSize);
+
+    /// Returns a pointer to the first element of the block at index.
+    [[nodiscard]] T *RB_NONNULL blockData(IndexType index) const noexcept [[clang::nonblocking]];
+
+    /// The memory holding the blocks.
+    unsigned char *RB_NULLABLE blocks_{nullptr};
+    /// The number of elements submitted in each block.
+    SizeType *RB_NULLABLE counts_{nullptr};
+    /// The number of blocks.
+    SizeType blockCount_{0};
+    /// The capacity of each block in elements.
+    SizeType blockSize_{0};
+    /// The distance between the starts of consecutive blocks in bytes.
+    SizeType blockStride_{0};
+
+    /// The indices of blocks submitted by the producer.
+    TypedRingBuffer<IndexType> filled_;
+    /// The indices of blocks released by the consumer.
+    TypedRingBuffer<IndexType> free_;
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+template <ByteCopyable T> inline BlockPool<T>::BlockPool(SizeType blockCount, SizeType blockSize) {
+    if (blockCount == 0 || blockCount > maxBlockCount || blockSize == 0) [[unlikely]] {
+        throw std::invalid_argument("block count or size out of range");
+    }
+    if (!allocate(blockCount, blockSize)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
+
+template <ByteCopyable T>
+inline BlockPool<T>::BlockPool(BlockPool &&other) noexcept
+    : blocks_{std::exchange(other.blocks_, nullptr)}, counts_{std::exchange(other.counts_, nullptr)},
+      blockCount_{std::exchange(other.blockCount_, 0)}, blockSize_{std::exchange(other.blockSize_, 0)},
+      blockStride_{std::exchange(other.blockStride_, 0)}, filled_{std::move(other.filled_)},
+      free_{std::move(other.free_)} {}
+
+template <ByteCopyable T> inline auto BlockPool<T>::operator=(BlockPool &&other) noexcept -> BlockPool & {
+    if (this != &other) [[likely]] {
+        deallocate();
+
+        blocks_ = std::exchange(other.blocks_, nullptr);
+        counts_ = std::exchange(other.counts_, nullptr);
+        blockCount_ = std::exchange(other.blockCount_, 0);
+        blockSize_ = std::exchange(other.blockSize_, 0);
+        blockStride_ = std::exchange(other.blockStride_, 0);
+        filled_ = std::move(other.filled_);
+        free_ = std::move(other.free_);
+    }
+    return *this;
+}
+
+template <ByteCopyable T> inline BlockPool<T>::~BlockPool() noexcept { deallocate(); }
+
+// MARK: Pool Management
+
+template <ByteCopyable T> inline bool BlockPool<T>::allocate(SizeType blockCount, SizeType blockSize) noexcept {
+    const auto maxBytes = std::numeric_limits<SizeType>::max() - blockAlignment;
+    if (blockCount == 0 || blockCount > maxBlockCount || blockSize == 0 ||
+        blockSize > maxBytes / sizeof(T) / blockCount) [[unlikely]] {
+        return false;
+    }
+
+    deallocate();
+
+    // Round each block up to a whole number of cache lines so no two blocks share one
+    const auto blockStride = (blockSize * sizeof(T) + blockAlignment - 1) & ~(blockAlignment - 1);
+    if (blockStride > maxBytes / blockCount) [[unlikely]] {
+        return false;
+    }
+
+    const auto ringCapacity = std::max(blockCount, TypedRingBuffer<IndexType>::minCapacity);
+    blocks_ = static_cast<unsigned char *>(
+            ::operator new(blockCount * blockStride, std::align_val_t{blockAlignment}, std::nothrow));
+    counts_ = new (std::nothrow) SizeType[blockCount]{};
+    if (blocks_ == nullptr || counts_ == nullptr || !filled_.allocate(ringCapacity) || !free_.allocate(ringCapacity))
+            [[unlikely]] {
+        deallocate();
+        return false;
+    }
+
+    blockCount_ = blockCount;
+    blockSize_ = blockSize;
+    blockStride_ = blockStride;
+
+    for (SizeType i = 0; i < blockCount; ++i) {
+        free_.write(static_cast<IndexType>(i));
+    }
+
+    return true;
+}
+
+template <ByteCopyable T> inline void BlockPool<T>::deallocate() noexcept {
+    if (blocks_ != nullptr) {
+        ::operator delete(blocks_, std::align_val_t{blockAlignment});
+        blocks_ = nullptr;
+    }
+    delete[] std::exchange(counts_, nullptr);
+
+    blockCount_ = 0;
+    blockSize_ = 0;
+    blockStride_ = 0;
+
+    filled_.deallocate();
+    free_.deallocate();
+}
+
+// MARK: Pool Information
+
+template <ByteCopyable T> inline BlockPool<T>::operator bool() const noexcept { return blocks_ != nullptr; }
+
+template <ByteCopyable T> inline auto BlockPool<T>::blockCount() const noexcept -> SizeType { return blockCount_; }
+
+template <ByteCopyable T> inline auto BlockPool<T>::blockSize() const noexcept -> SizeType { return blockSize_; }
+
+template <ByteCopyable T> inline auto BlockPool<T>::freeBlocks() const noexcept -> SizeType { return free_.size(); }
+
+template <ByteCopyable T> inline auto BlockPool<T>::filledBlocks() const noexcept -> SizeType { return filled_.size(); }
+
+// MARK: Producing
+
+template <ByteCopyable T> inline auto BlockPool<T>::acquire() noexcept -> std::optional<Block> {
+    IndexType index;
+    if (!free_.read(index)) {
+        return std::nullopt;
+    }
+    return Block{index, {blockData(index), blockSize_}};
+}
+
+template <ByteCopyable T> inline void BlockPool<T>::submit(IndexType index, SizeType count) noexcept {
+    // The count is published to the consumer by the release store of the write position
+    counts_[index] = std::min(count, blockSize_);
+    filled_.write(index);
+}
+
+// MARK: Consuming
+
+template <ByteCopyable T> inline auto BlockPool<T>::receive() noexcept -> std::optional<Block> {
+    IndexType index;
+    if (!filled_.read(index)) {
+        return std::nullopt;
+    }
+    return Block{index, {blockData(index), counts_[index]}};
+}
+
+template <ByteCopyable T> inline void BlockPool<T>::release(IndexType index) noexcept { free_.write(index); }
+
+// MARK: Helpers
+
+template <ByteCopyable T> inline T *BlockPool<T>::blockData(IndexType index) const noexcept {
+    return reinterpret_cast<T *>(blocks_ + index * blockStride_);
+}
+
+} /* namespace spsc */
+
+#endif
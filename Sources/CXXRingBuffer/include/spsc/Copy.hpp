@@ -0,0 +1,188 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_COPY_HPP
+#define SPSC_COPY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define RB_HAS_SSE2_STREAMING
+#include <emmintrin.h>
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define RB_HAS_NEON_STREAMING
+#endif
+
+namespace spsc {
+
+/// How data is copied between caller memory and a ring buffer.
+///
+/// A copy mode only takes effect for transfers of at least ``largeCopyThreshold`` bytes; smaller transfers always use
+/// `std::memcpy`.
+enum class CopyMode : std::uint8_t {
+    /// Copy with `std::memcpy`.
+    standard,
+    /// Store to the destination with non-temporal stores that bypass the cache.
+    ///
+    /// This avoids evicting the working set when the destination will not be read again for some time, such as data
+    /// written for a consumer that lags by milliseconds.
+    streaming,
+    /// Prefetch the source ahead of the copy.
+    prefetch,
+};
+
+/// The minimum size in bytes of a transfer for which a copy mode other than ``CopyMode::standard`` takes effect.
+inline constexpr std::size_t largeCopyThreshold = 256 * 1024;
+
+namespace detail {
+
+/// Copies size bytes from src to dst using non-temporal stores where available.
+/// @note The stores are weakly ordered, so ``streamingFence()`` must be called before publishing the data.
+inline void copyStreaming(unsigned char *dst, const unsigned char *src, std::size_t size) noexcept {
+#if defined(RB_HAS_SSE2_STREAMING) || defined(RB_HAS_NEON_STREAMING)
+    constexpr std::size_t blockSize = 64;
+
+    // Non-temporal stores require an aligned destination
+    const auto head = std::min(size, (blockSize - reinterpret_cast<std::uintptr_t>(dst) % blockSize) % blockSize);
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    size -= head;
+
+    for (; size >= blockSize; size -= blockSize, dst += blockSize, src += blockSize) {
+#if defined(RB_HAS_SSE2_STREAMING)
+        const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+        const auto c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 32));
+        const auto d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst), a);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 48), d);
+#else
+        __asm__ __volatile__("ldp q0, q1, [%1]\n\t"
+                             "ldp q2, q3, [%1, #32]\n\t"
+                             "stnp q0, q1, [%0]\n\t"
+                             "stnp q2, q3, [%0, #32]"
+                             :
+                             : "r"(dst), "r"(src)
+                             : "v0", "v1", "v2", "v3", "memory");
+#endif
+    }
+#endif
+
+    std::memcpy(dst, src, size);
+}
+
+/// Orders preceding non-temporal stores before subsequent stores.
+inline void streamingFence() noexcept {
+#if defined(RB_HAS_SSE2_STREAMING)
+    _mm_sfence();
+#endif
+}
+
+/// Copies size bytes from src to dst, prefetching the source ahead of the copy.
+inline void copyPrefetching(unsigned char *dst, const unsigned char *src, std::size_t size) noexcept {
+    constexpr std::size_t blockSize = 256;
+    constexpr std::size_t lineSize = 64;
+    constexpr std::size_t distance = 8 * blockSize;
+
+    for (std::size_t offset = 0; offset < size; offset += blockSize) {
+        if (offset + distance < size) {
+            for (std::size_t line = 0; line < blockSize; line += lineSize) {
+#if defined(__GNUC__) || defined(__clang__)
+                __builtin_prefetch(src + offset + distance + line, 0, 0);
+#elif defined(RB_HAS_SSE2_STREAMING)
+                _mm_prefetch(reinterpret_cast<const char *>(src + offset + distance + line), _MM_HINT_NTA);
+#endif
+            }
+        }
+        std::memcpy(dst + offset, src + offset, std::min(blockSize, size - offset));
+    }
+}
+
+/// The largest size in bytes copied by ``copySmall()``.
+inline constexpr std::size_t smallCopyLimit = 64;
+
+/// Copies size bytes, at least N and at most twice N, from src to dst with two N-byte copies that overlap in the
+/// middle.
+template <std::size_t N>
+inline void copyOverlapping(unsigned char *dst, const unsigned char *src, std::size_t size) noexcept {
+    std::memcpy(dst, src, N);
+    std::memcpy(dst + size - N, src + size - N, N);
+}
+
+/// Copies size bytes, which is at most MaxSize, from src to dst.
+///
+/// Up to ``smallCopyLimit`` bytes each size class is copied with two fixed-size copies that overlap in the middle,
+/// which compile to a pair of unaligned vector or register loads and stores rather than a call with a size-dependent
+/// loop. Only the size classes no larger than MaxSize are emitted, so no copy is wider than the regions involved.
+template <std::size_t MaxSize>
+inline void copyUpTo(unsigned char *dst, const unsigned char *src, std::size_t size) noexcept {
+    if constexpr (MaxSize > smallCopyLimit) {
+        std::memcpy(dst, src, size);
+    } else {
+        if constexpr (MaxSize >= 32) {
+            if (size >= 32) {
+                copyOverlapping<32>(dst, src, size);
+                return;
+            }
+        }
+        if constexpr (MaxSize >= 16) {
+            if (size >= 16) {
+                copyOverlapping<16>(dst, src, size);
+                return;
+            }
+        }
+        if constexpr (MaxSize >= 8) {
+            if (size >= 8) {
+                copyOverlapping<8>(dst, src, size);
+                return;
+            }
+        }
+        if constexpr (MaxSize >= 4) {
+            if (size >= 4) {
+                copyOverlapping<4>(dst, src, size);
+                return;
+            }
+        }
+        if (size > 0) {
+            dst[0] = src[0];
+            dst[size / 2] = src[size / 2];
+            dst[size - 1] = src[size - 1];
+        }
+    }
+}
+
+/// Copies size bytes, at most ``smallCopyLimit``, from src to dst.
+inline void copySmall(unsigned char *dst, const unsigned char *src, std::size_t size) noexcept {
+    copyUpTo<smallCopyLimit>(dst, src, size);
+}
+
+/// Copies size bytes, more than ``smallCopyLimit``, from src to dst as directed by mode.
+///
+/// This function is defined out of line so that copies of small fixed-size objects inlined into a caller never
+/// contain a copy of more than ``smallCopyLimit`` bytes.
+void copyLarge(unsigned char *dst, const unsigned char *src, std::size_t size, CopyMode mode) noexcept;
+
+/// Copies size bytes from src to dst as directed by mode.
+inline void copy(unsigned char *dst, const unsigned char *src, std::size_t size, CopyMode mode) noexcept {
+    if (size <= smallCopyLimit) [[likely]] {
+        copySmall(dst, src, size);
+    } else {
+        copyLarge(dst, src, size, mode);
+    }
+}
+
+} /* namespace detail */
+
+} /* namespace spsc */
+
+#endif
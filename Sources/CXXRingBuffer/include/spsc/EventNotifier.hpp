@@ -0,0 +1,132 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_EVENT_NOTIFIER_HPP
+#define SPSC_EVENT_NOTIFIER_HPP
+
+#include "spsc/WaitStrategy.hpp"
+
+#include <coroutine>
+#include <utility>
+
+namespace spsc {
+
+template <typename Derived> class RingBufferBase;
+
+/// A file descriptor that becomes readable when one side of a ring buffer is ready.
+///
+/// An event loop waits on ``fd()`` with epoll, kqueue, poll, or select alongside its other descriptors. The side
+/// waiting on the ring buffer arms the notifier with ``RingBufferBase::armReadable`` or
+/// ``RingBufferBase::armWritable`` when it runs out of data or space, and the other side signals it from
+/// ``notifyConsumer`` or ``notifyProducer`` once data or space is available again. Arming is edge-triggered: a
+/// notifier is signaled at most once per arming, so there is at most one system call per transition regardless of
+/// how many writes or reads occur.
+///
+/// A typical consumer handles readiness of the descriptor by clearing it, then draining the ring buffer and arming
+/// again until arming succeeds:
+///
+/// ```
+/// notifier.clear();
+/// do {
+///     while (ring.read(message)) { /* ... */ }
+/// } while (!ring.armReadable(notifier));
+/// ```
+///
+/// The descriptor is an eventfd on Linux and the read end of a nonblocking pipe on Darwin.
+/// @note Event notifiers are only available on Linux and Darwin.
+class EventNotifier final {
+  public:
+    // MARK: Construction and Destruction
+
+    /// Creates a notifier without a file descriptor.
+    /// @note ``open`` must be called before the object may be used.
+    EventNotifier() noexcept = default;
+
+    EventNotifier(const EventNotifier &) = delete;
+    EventNotifier &operator=(const EventNotifier &) = delete;
+
+    /// Creates a notifier by moving another notifier's file descriptors.
+    /// @note This method must not be called while other is armed.
+    /// @param other The notifier to move.
+    EventNotifier(EventNotifier &&other) noexcept;
+
+    /// Closes any file descriptors and moves another notifier's file descriptors into this notifier.
+    /// @note This method must not be called while either notifier is armed.
+    /// @param other The notifier to move.
+    EventNotifier &operator=(EventNotifier &&other) noexcept;
+
+    /// Closes the file descriptors.
+    ~EventNotifier() noexcept;
+
+    // MARK: Descriptor Management
+
+    /// Creates the file descriptors, closing any existing ones.
+    /// @return true on success, false if the file descriptors could not be created.
+    bool open() noexcept;
+
+    /// Closes the file descriptors.
+    /// @note This method must not be called while the notifier is armed.
+    void close() noexcept;
+
+    /// Returns true if the notifier has file descriptors.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the file descriptor to wait on for readability, or -1 if there is none.
+    [[nodiscard]] int fd() const noexcept [[clang::nonblocking]];
+
+    // MARK: Signaling
+
+    /// Makes the file descriptor readable.
+    ///
+    /// Signals coalesce: the descriptor remains readable, and a single ``clear`` resets it, however many times this
+    /// method is called.
+    void signal() const noexcept;
+
+    /// Makes the file descriptor unreadable, consuming any pending signals.
+    void clear() const noexcept;
+
+  private:
+    template <typename Derived> friend class RingBufferBase;
+
+    /// Signals the notifier passed as context.
+    static void signalContinuation(void *context, std::coroutine_handle<> /*coroutine*/) noexcept;
+
+    /// The descriptor waited on.
+    int readFD_{-1};
+    /// The descriptor written to signal, which may equal readFD_.
+    int writeFD_{-1};
+    /// The continuation published to the ring buffer when armed.
+    detail::Continuation continuation_{.count = 1, .schedule = signalContinuation, .scheduler = this};
+};
+
+// MARK: - Implementation -
+
+inline EventNotifier::EventNotifier(EventNotifier &&other) noexcept
+    : readFD_{std::exchange(other.readFD_, -1)}, writeFD_{std::exchange(other.writeFD_, -1)} {}
+
+inline EventNotifier &EventNotifier::operator=(EventNotifier &&other) noexcept {
+    if (this != &other) [[likely]] {
+        close();
+        readFD_ = std::exchange(other.readFD_, -1);
+        writeFD_ = std::exchange(other.writeFD_, -1);
+    }
+    return *this;
+}
+
+inline EventNotifier::~EventNotifier() noexcept { close(); }
+
+inline EventNotifier::operator bool() const noexcept { return readFD_ != -1; }
+
+inline int EventNotifier::fd() const noexcept { return readFD_; }
+
+inline void EventNotifier::signalContinuation(void *context, std::coroutine_handle<> /*coroutine*/) noexcept {
+    static_cast<const EventNotifier *>(context)->signal();
+}
+
+} /* namespace spsc */
+
+#endif
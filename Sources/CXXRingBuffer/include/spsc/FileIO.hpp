@@ -0,0 +1,153 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_FILE_IO_HPP
+#define SPSC_FILE_IO_HPP
+
+#include "spsc/RingBuffer.hpp"
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#include <cerrno>
+#include <span>
+#include <utility>
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace spsc {
+
+/// Transfers data between a ring buffer and a file descriptor without an intermediate buffer.
+///
+/// Data moves directly between the file descriptor and the two regions of the ring buffer's write or read vector
+/// with a single system call, which is then committed by the number of bytes actually transferred. Calls interrupted
+/// by a signal are retried.
+///
+/// Each function returns the number of bytes transferred, or -1 with errno set if the system call fails. When reading
+/// into a full ring buffer no system call is made and -1 is returned with errno set to `ENOBUFS`, so a return value of
+/// 0 always indicates end of file or a closed connection. When writing from an empty ring buffer no system call is
+/// made and 0 is returned.
+/// @note Only available on Linux and Darwin.
+namespace io {
+
+namespace detail {
+
+/// Fills iov with the nonempty regions of vector and returns the number of entries used.
+template <typename T> inline int toIovec(const std::pair<std::span<T>, std::span<T>> &vector, ::iovec (&iov)[2]) {
+    auto count = 0;
+    for (const auto &region : {vector.first, vector.second}) {
+        if (!region.empty()) {
+            iov[count++] = {const_cast<unsigned char *>(region.data()), region.size()};
+        }
+    }
+    return count;
+}
+
+/// Calls op until it does not fail with EINTR.
+template <typename Op> inline ::ssize_t retry(Op &&op) {
+    ::ssize_t result;
+    do {
+        result = op();
+    } while (result == -1 && errno == EINTR);
+    return result;
+}
+
+} /* namespace detail */
+
+/// Reads from a file descriptor into the ring buffer's free space with `readv`.
+/// @note This function is only safe to call from the producer.
+/// @param ring The ring buffer to write to.
+/// @param fd The file descriptor to read from.
+/// @return The number of bytes read, 0 at end of file, or -1 on error or with errno set to `ENOBUFS` if the ring
+/// buffer is full.
+template <typename Derived> inline ::ssize_t readFromFile(RingBufferBase<Derived> &ring, int fd) noexcept {
+    ::iovec iov[2];
+    const auto count = detail::toIovec(ring.writeVector(), iov);
+    if (count == 0) {
+        errno = ENOBUFS;
+        return -1;
+    }
+    const auto result = detail::retry([&] { return ::readv(fd, iov, count); });
+    if (result > 0) {
+        ring.commitWrite(static_cast<std::size_t>(result));
+    }
+    return result;
+}
+
+/// Writes the ring buffer's available data to a file descriptor with `writev`.
+/// @note This function is only safe to call from the consumer.
+/// @param ring The ring buffer to read from.
+/// @param fd The file descriptor to write to.
+/// @return The number of bytes written, 0 if the ring buffer is empty, or -1 on error.
+template <typename Derived> inline ::ssize_t writeToFile(RingBufferBase<Derived> &ring, int fd) noexcept {
+    ::iovec iov[2];
+    const auto count = detail::toIovec(ring.readVector(), iov);
+    if (count == 0) {
+        return 0;
+    }
+    const auto result = detail::retry([&] { return ::writev(fd, iov, count); });
+    if (result > 0) {
+        ring.commitRead(static_cast<std::size_t>(result));
+    }
+    return result;
+}
+
+/// Receives from a socket into the ring buffer's free space with `recvmsg`.
+/// @note This function is only safe to call from the producer.
+/// @param ring The ring buffer to write to.
+/// @param socket The socket to receive from.
+/// @param flags Flags passed to `recvmsg`, such as `MSG_DONTWAIT`.
+/// @return The number of bytes received, 0 if the peer has shut down, or -1 on error or with errno set to `ENOBUFS` if
+/// the ring buffer is full.
+template <typename Derived>
+inline ::ssize_t receiveFromSocket(RingBufferBase<Derived> &ring, int socket, int flags = 0) noexcept {
+    ::msghdr message{};
+    ::iovec iov[2];
+    message.msg_iov = iov;
+    message.msg_iovlen = detail::toIovec(ring.writeVector(), iov);
+    if (message.msg_iovlen == 0) {
+        errno = ENOBUFS;
+        return -1;
+    }
+    const auto result = detail::retry([&] { return ::recvmsg(socket, &message, flags); });
+    if (result > 0) {
+        ring.commitWrite(static_cast<std::size_t>(result));
+    }
+    return result;
+}
+
+/// Sends the ring buffer's available data to a socket with `sendmsg`.
+/// @note This function is only safe to call from the consumer.
+/// @param ring The ring buffer to read from.
+/// @param socket The socket to send to.
+/// @param flags Flags passed to `sendmsg`, such as `MSG_NOSIGNAL` or `MSG_DONTWAIT`.
+/// @return The number of bytes sent, 0 if the ring buffer is empty, or -1 on error.
+template <typename Derived>
+inline ::ssize_t sendToSocket(RingBufferBase<Derived> &ring, int socket, int flags = 0) noexcept {
+    ::msghdr message{};
+    ::iovec iov[2];
+    message.msg_iov = iov;
+    message.msg_iovlen = detail::toIovec(ring.readVector(), iov);
+    if (message.msg_iovlen == 0) {
+        return 0;
+    }
+    const auto result = detail::retry([&] { return ::sendmsg(socket, &message, flags); });
+    if (result > 0) {
+        ring.commitRead(static_cast<std::size_t>(result));
+    }
+    return result;
+}
+
+} /* namespace io */
+
+} /* namespace spsc */
+
+#endif
+
+#endif
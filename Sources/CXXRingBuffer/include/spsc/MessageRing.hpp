@@ -0,0 +1,376 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_MESSAGE_RING_HPP
+#define SPSC_MESSAGE_RING_HPP
+
+#include "spsc/RingBuffer.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace spsc {
+
+/// A lock-free SPSC ring buffer of variable-length messages.
+///
+/// This class is thread safe when used with a single producer and a single consumer.
+///
+/// Each message is stored as a length header followed by its payload and is published with a single commit, so the
+/// consumer never observes a header without its payload. A message never wraps around the end of the buffer: when it
+/// would, the remaining bytes are filled with a padding record and the message is placed at the start of the buffer.
+/// Payloads are therefore always contiguous and may be read and written in place.
+class MessageRing final {
+  public:
+    /// Unsigned integer type.
+    using SizeType = RingBuffer::SizeType;
+    /// The type of a message header.
+    using HeaderType = std::uint32_t;
+
+    /// The size of a message header in bytes.
+    static constexpr auto headerSize = SizeType{sizeof(HeaderType)};
+    /// The alignment of message headers and payloads in the ring buffer.
+    static constexpr auto messageAlignment = headerSize;
+
+    /// The minimum supported ring buffer capacity in bytes.
+    static constexpr auto minCapacity = SizeType{4 * headerSize};
+    /// The maximum supported ring buffer capacity in bytes.
+    static constexpr auto maxCapacity = RingBuffer::maxCapacity;
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty message ring.
+    /// @note ``allocate`` must be called before the object may be used.
+    MessageRing() noexcept = default;
+
+    /// Creates a message ring with the specified minimum capacity.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param options Options controlling how the memory is allocated.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
+    /// supported.
+    explicit MessageRing(SizeType minCapacity, const RingBuffer::AllocationOptions &options = {});
+
+    MessageRing(const MessageRing &) = delete;
+    MessageRing &operator=(const MessageRing &) = delete;
+
+    /// Creates a message ring by moving the contents of another message ring.
+    /// @note This method is not thread safe for the message ring being moved.
+    /// @param other The message ring to move.
+    MessageRing(MessageRing &&other) noexcept;
+
+    /// Moves the contents of another message ring into this message ring.
+    /// @note This method is not thread safe.
+    /// @param other The message ring to move.
+    MessageRing &operator=(MessageRing &&other) noexcept;
+
+    /// Destroys the message ring and releases all associated resources.
+    ~MessageRing() noexcept = default;
+
+    // MARK: Buffer Management
+
+    /// Allocates space for messages.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @note This method is not thread safe.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param options Options controlling how the memory is allocated.
+    /// @return true on success, false if memory could not be allocated or the buffer capacity is not supported.
+    bool allocate(SizeType minCapacity, const RingBuffer::AllocationOptions &options = {}) noexcept
+            [[clang::allocating]];
+
+    /// Frees any space allocated for messages.
+    /// @note This method is not thread safe.
+    void deallocate() noexcept;
+
+    // MARK: Buffer Information
+
+    /// Returns true if the message ring has space for messages.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the capacity of the message ring.
+    /// @note This method is safe to call from both producer and consumer.
+    /// @return The ring buffer capacity in bytes, including space used by headers and padding.
+    [[nodiscard]] SizeType capacity() const noexcept [[clang::nonblocking]];
+
+    /// Returns the size of the largest message that can be written.
+    ///
+    /// A message of this size always fits once the consumer has released all earlier messages.
+    /// @note This method is safe to call from both producer and consumer.
+    /// @return The maximum payload size in bytes.
+    [[nodiscard]] SizeType maxMessageSize() const noexcept [[clang::nonblocking]];
+
+    /// Returns true if the message ring contains no messages that have not been returned by ``tryReadMessage()``.
+    /// @note The result of this method is only accurate when called from the consumer.
+    /// @return true if no messages are available for reading.
+    [[nodiscard]] bool isEmpty() const noexcept [[clang::nonblocking]];
+
+    // MARK: Writing
+
+    /// Writes a message and commits it together with any reserved messages.
+    /// @note This method is only safe to call from the producer.
+    /// @param ptr An address containing the payload to copy.
+    /// @param size The size of the payload in bytes.
+    /// @return true if the message was written, false if insufficient free space is available.
+    bool tryWriteMessage(const void *const RB_NULLABLE ptr, SizeType size) noexcept [[clang::nonblocking]];
+
+    /// Writes a message and commits it together with any reserved messages.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam T The type of the payload items.
+    /// @param payload A span containing the payload to copy.
+    /// @return true if the message was written, false if insufficient free space is available.
+    template <ByteCopyable T>
+    bool tryWriteMessage(std::span<const T> payload) noexcept [[clang::nonblocking]];
+
+    /// Reserves space for a message to be written in place.
+    ///
+    /// The message is not visible to the consumer until ``commitMessages()`` is called. Several messages may be
+    /// reserved before they are committed together.
+    /// @note This method is only safe to call from the producer.
+    /// @param size The size of the payload in bytes.
+    /// @return A std::optional containing a contiguous span to receive the payload if sufficient free space is
+    /// available.
+    [[nodiscard]] std::optional<std::span<unsigned char>> tryReserveMessage(SizeType size) noexcept
+            [[clang::nonblocking]];
+
+    /// Makes all reserved messages visible to the consumer.
+    /// @note This method is only safe to call from the producer.
+    void commitMessages() noexcept [[clang::nonblocking]];
+
+    /// Discards all reserved messages.
+    /// @note This method is only safe to call from the producer.
+    void cancelMessages() noexcept [[clang::nonblocking]];
+
+    // MARK: Reading
+
+    /// Returns the next message without copying it.
+    ///
+    /// The payload remains valid until ``releaseMessages()`` is called. Messages may be read repeatedly before they
+    /// are released together.
+    /// @note This method is only safe to call from the consumer.
+    /// @return A std::optional containing a contiguous span of the payload if a message is available.
+    [[nodiscard]] std::optional<std::span<const unsigned char>> tryReadMessage() noexcept [[clang::nonblocking]];
+
+    /// Returns the space occupied by all messages returned by ``tryReadMessage()`` to the producer.
+    /// @note This method is only safe to call from the consumer.
+    void releaseMessages() noexcept [[clang::nonblocking]];
+
+  private:
+    /// The header value marking the remainder of the buffer as padding.
+    static constexpr auto paddingMarker = std::numeric_limits<HeaderType>::max();
+
+    /// The underlying byte ring buffer.
+    RingBuffer ring_;
+    /// The number of bytes reserved by the producer but not yet committed.
+    alignas(cacheLineSize) SizeType reservedBytes_{0};
+    /// The number of bytes read by the consumer but not yet released.
+    alignas(cacheLineSize) SizeType pendingBytes_{0};
+
+    /// Returns the number of bytes occupied by a message with a payload of size bytes.
+    [[nodiscard]] static constexpr SizeType recordSize(SizeType size) noexcept [[clang::nonblocking]];
+
+    /// Locates space for a record of recordBytes bytes following the reserved bytes in a write vector.
+    /// @return The address of the record or nullptr if the write vector is too small.
+    unsigned char *RB_NULLABLE place(const RingBuffer::WriteVector &vector, SizeType recordBytes) noexcept
+            [[clang::nonblocking]];
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+inline MessageRing::MessageRing(SizeType minCapacity, const RingBuffer::AllocationOptions &options) {
+    if (minCapacity < MessageRing::minCapacity || minCapacity > MessageRing::maxCapacity) [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
+    if (!allocate(minCapacity, options)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
+
+inline MessageRing::MessageRing(MessageRing &&other) noexcept
+    : ring_{std::move(other.ring_)}, reservedBytes_{std::exchange(other.reservedBytes_, 0)},
+      pendingBytes_{std::exchange(other.pendingBytes_, 0)} {}
+
+inline auto MessageRing::operator=(MessageRing &&other) noexcept -> MessageRing & {
+    if (this != &other) [[likely]] {
+        ring_ = std::move(other.ring_);
+        reservedBytes_ = std::exchange(other.reservedBytes_, 0);
+        pendingBytes_ = std::exchange(other.pendingBytes_, 0);
+    }
+    return *this;
+}
+
+// MARK: Buffer Management
+
+inline bool MessageRing::allocate(SizeType minCapacity, const RingBuffer::AllocationOptions &options) noexcept {
+    if (minCapacity < MessageRing::minCapacity || minCapacity > MessageRing::maxCapacity) [[unlikely]] {
+        return false;
+    }
+    reservedBytes_ = 0;
+    pendingBytes_ = 0;
+    return ring_.allocate(minCapacity, options);
+}
+
+inline void MessageRing::deallocate() noexcept {
+    ring_.deallocate();
+    reservedBytes_ = 0;
+    pendingBytes_ = 0;
+}
+
+// MARK: Buffer Information
+
+inline MessageRing::operator bool() const noexcept { return static_cast<bool>(ring_); }
+
+inline auto MessageRing::capacity() const noexcept -> SizeType { return ring_.capacity(); }
+
+inline auto MessageRing::maxMessageSize() const noexcept -> SizeType {
+    if (!ring_) [[unlikely]] {
+        return 0;
+    }
+    // Without mirroring a message must fit in whichever side of the write position is larger
+    const auto maxRecordSize = ring_.isMirrored() ? ring_.capacity() : ring_.capacity() / 2;
+    return std::min(maxRecordSize - headerSize, SizeType{paddingMarker - 1});
+}
+
+inline bool MessageRing::isEmpty() const noexcept { return ring_.availableBytes() == pendingBytes_; }
+
+// MARK: Writing
+
+inline bool MessageRing::tryWriteMessage(const void *const RB_NULLABLE ptr, SizeType size) noexcept {
+    if (ptr == nullptr && size > 0) [[unlikely]] {
+        return false;
+    }
+
+    const auto payload = tryReserveMessage(size);
+    if (!payload) {
+        return false;
+    }
+
+    if (size > 0) [[likely]] {
+        std::memcpy(payload->data(), ptr, size);
+    }
+    commitMessages();
+    return true;
+}
+
+template <ByteCopyable T> inline bool MessageRing::tryWriteMessage(std::span<const T> payload) noexcept {
+    return tryWriteMessage(payload.data(), payload.size_bytes());
+}
+
+inline auto MessageRing::tryReserveMessage(SizeType size) noexcept -> std::optional<std::span<unsigned char>> {
+    if (size > maxMessageSize()) [[unlikely]] {
+        return std::nullopt;
+    }
+
+    const auto recordBytes = recordSize(size);
+    auto *record = place(ring_.writeVector(reservedBytes_ + recordBytes), recordBytes);
+    if (record == nullptr) {
+        // The cached read position may be stale or the record may need padding, so observe all free space
+        record = place(ring_.writeVector(), recordBytes);
+        if (record == nullptr) {
+            return std::nullopt;
+        }
+    }
+
+    const auto header = static_cast<HeaderType>(size);
+    std::memcpy(record, &header, headerSize);
+    return std::span{record + headerSize, size};
+}
+
+inline void MessageRing::commitMessages() noexcept {
+    if (reservedBytes_ > 0) {
+        ring_.commitWrite(std::exchange(reservedBytes_, 0));
+    }
+}
+
+inline void MessageRing::cancelMessages() noexcept { reservedBytes_ = 0; }
+
+// MARK: Reading
+
+inline auto MessageRing::tryReadMessage() noexcept -> std::optional<std::span<const unsigned char>> {
+    for (;;) {
+        const auto offset = pendingBytes_;
+        const auto [front, back] = ring_.readVector(offset + headerSize);
+        if (front.size() + back.size() < offset + headerSize) {
+            return std::nullopt;
+        }
+
+        // Records are published whole and never wrap, so the entire record is readable and contiguous
+        const auto *record = offset < front.size() ? front.data() + offset : back.data() + (offset - front.size());
+        HeaderType header;
+        std::memcpy(&header, record, headerSize);
+
+        if (header == paddingMarker) {
+            assert(offset < front.size() && "Padding must precede the end of the buffer");
+            pendingBytes_ = front.size();
+            continue;
+        }
+
+        pendingBytes_ = offset + recordSize(header);
+        assert(pendingBytes_ <= front.size() + back.size() && "Message truncated");
+        return std::span{record + headerSize, header};
+    }
+}
+
+inline void MessageRing::releaseMessages() noexcept {
+    if (pendingBytes_ > 0) {
+        ring_.commitRead(std::exchange(pendingBytes_, 0));
+    }
+}
+
+// MARK: Records
+
+constexpr auto MessageRing::recordSize(SizeType size) noexcept -> SizeType {
+    return (headerSize + size + messageAlignment - 1) & ~(messageAlignment - 1);
+}
+
+inline auto MessageRing::place(const RingBuffer::WriteVector &vector, SizeType recordBytes) noexcept
+        -> unsigned char * {
+    const auto &[front, back] = vector;
+
+    if (reservedBytes_ >= front.size()) {
+        // Earlier reservations have already wrapped to the start of the buffer
+        const auto offset = reservedBytes_ - front.size();
+        if (offset + recordBytes > back.size()) {
+            return nullptr;
+        }
+        reservedBytes_ += recordBytes;
+        return back.data() + offset;
+    }
+
+    auto *record = front.data() + reservedBytes_;
+    const auto bytesToEnd = front.size() - reservedBytes_;
+    if (recordBytes <= bytesToEnd) [[likely]] {
+        reservedBytes_ += recordBytes;
+        return record;
+    }
+
+    // A non-empty back span means the front span reaches the end of the buffer. The alignment of records ensures at
+    // least one header fits in the remaining bytes.
+    if (back.size() < recordBytes) {
+        return nullptr;
+    }
+    std::memcpy(record, &paddingMarker, headerSize);
+    reservedBytes_ += bytesToEnd + recordBytes;
+    return back.data();
+}
+
+} /* namespace spsc */
+
+#endif
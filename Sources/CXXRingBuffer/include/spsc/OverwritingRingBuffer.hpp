@@ -0,0 +1,409 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_OVERWRITING_RING_BUFFER_HPP
+#define SPSC_OVERWRITING_RING_BUFFER_HPP
+
+#include "spsc/RingBuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+
+namespace spsc {
+
+/// A lock-free SPSC ring buffer whose producer overwrites the oldest unread data instead of running out of space.
+///
+/// This class is thread safe when used with a single producer and a single consumer.
+///
+/// Writes always succeed. When the consumer falls more than the ring buffer capacity behind, the oldest unread data
+/// is discarded: the consumer detects that it was overrun, moves its read position to the oldest intact data and
+/// counts the loss. This suits telemetry, trace and metering taps where the newest data matters most and the producer
+/// must never stall.
+///
+/// Overwrites are detected in the manner of a sequence lock: the producer announces the extent of the space it is
+/// about to write before writing it, and the consumer checks the announcement after copying data out, retrying if
+/// the copied data was overwritten.
+/// @note After an overrun the read position lands on a byte boundary. To resynchronize on item boundaries write items
+/// of a single size that divides the capacity, such as a power of two.
+class OverwritingRingBuffer final {
+  public:
+    /// Unsigned integer type.
+    using SizeType = std::size_t;
+    /// Atomic unsigned integer type.
+    using AtomicSizeType = std::atomic<SizeType>;
+
+    /// The minimum supported ring buffer capacity in bytes.
+    static constexpr auto minCapacity = SizeType{2};
+    /// The maximum supported ring buffer capacity in bytes.
+    static constexpr auto maxCapacity = SizeType{1} << (std::numeric_limits<SizeType>::digits - 1);
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty ring buffer.
+    /// @note ``allocate`` must be called before the object may be used.
+    OverwritingRingBuffer() noexcept = default;
+
+    /// Creates a ring buffer with the specified minimum capacity.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
+    /// supported.
+    explicit OverwritingRingBuffer(SizeType minCapacity);
+
+    OverwritingRingBuffer(const OverwritingRingBuffer &) = delete;
+    OverwritingRingBuffer &operator=(const OverwritingRingBuffer &) = delete;
+    OverwritingRingBuffer(OverwritingRingBuffer &&) = delete;
+    OverwritingRingBuffer &operator=(OverwritingRingBuffer &&) = delete;
+
+    /// Destroys the ring buffer and releases all associated resources.
+    ~OverwritingRingBuffer() noexcept;
+
+    // MARK: Buffer Management
+
+    /// Allocates space for data.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @note This method is not thread safe.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @return true on success, false if memory could not be allocated or the buffer capacity is not supported.
+    bool allocate(SizeType minCapacity) noexcept [[clang::allocating]];
+
+    /// Frees any space allocated for data.
+    /// @note This method is not thread safe.
+    void deallocate() noexcept;
+
+    // MARK: Buffer Information
+
+    /// Returns true if the ring buffer has allocated space for data.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the capacity of the ring buffer.
+    /// @return The ring buffer capacity in bytes.
+    [[nodiscard]] SizeType capacity() const noexcept [[clang::nonblocking]];
+
+    // MARK: Overrun Information
+
+    /// Returns the number of unread bytes the producer has overwritten.
+    /// @note This method is only safe to call from the producer.
+    [[nodiscard]] SizeType overwrittenBytes() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of bytes the consumer has lost to overwrites.
+    /// @note This method is only safe to call from the consumer.
+    [[nodiscard]] SizeType missedBytes() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of times the consumer has been overrun.
+    ///
+    /// The count serves as an epoch: if it changed across reads, the data read before and after it changed is not
+    /// contiguous.
+    /// @note This method is only safe to call from the consumer.
+    [[nodiscard]] SizeType overrunCount() const noexcept [[clang::nonblocking]];
+
+    // MARK: Writing
+
+    /// Writes data, overwriting the oldest unread data if necessary, and advances the write position.
+    ///
+    /// If the data is larger than the capacity only the items at its end are written.
+    /// @note This method is only safe to call from the producer.
+    /// @param ptr An address containing the data to copy.
+    /// @param itemSize The size of an individual item in bytes.
+    /// @param itemCount The desired number of items to write.
+    /// @return The number of items actually written.
+    SizeType write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount) noexcept
+            [[clang::nonblocking]];
+
+    /// Writes items, overwriting the oldest unread data if necessary, and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam T The type to write.
+    /// @param data A span containing the items to copy.
+    /// @return The number of items actually written.
+    template <ByteCopyable T> SizeType write(std::span<const T> data) noexcept [[clang::nonblocking]];
+
+    /// Writes a value, overwriting the oldest unread data if necessary, and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @param value The value to write.
+    /// @return true if value was written, false if it is larger than the capacity.
+    bool write(ValueLike auto const &value) noexcept [[clang::nonblocking]];
+
+    // MARK: Reading
+
+    /// Returns the amount of intact data available for reading.
+    /// @note This method is only safe to call from the consumer.
+    /// @return The number of bytes available for reading.
+    [[nodiscard]] SizeType availableBytes() noexcept [[clang::nonblocking]];
+
+    /// Reads data and advances the read position.
+    ///
+    /// Data overwritten during the copy is never returned.
+    /// @note This method is only safe to call from the consumer.
+    /// @param ptr An address to receive the data.
+    /// @param itemSize The size of an individual item in bytes.
+    /// @param itemCount The desired number of items to read.
+    /// @param allowPartial Whether any items should be read if the number of items available to read is less than
+    /// itemCount.
+    /// @return The number of items actually read.
+    SizeType read(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, bool allowPartial) noexcept
+            [[clang::nonblocking]];
+
+    /// Reads items and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam T The type to read.
+    /// @param buffer A span to receive the items.
+    /// @param allowPartial Whether any items should be read if the number of items available to read is less than
+    /// buffer.size().
+    /// @return The number of items actually read.
+    template <ByteCopyable T>
+    SizeType read(std::span<T> buffer, bool allowPartial = true) noexcept [[clang::nonblocking]];
+
+    /// Reads a value and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @param value The destination value.
+    /// @return true on success, false otherwise.
+    bool read(ValueLike auto &value) noexcept [[clang::nonblocking]];
+
+  private:
+    /// The memory buffer holding the data.
+    unsigned char *RB_NULLABLE buffer_{nullptr};
+    /// The capacity of buffer_ in bytes.
+    SizeType capacity_{0};
+    /// The capacity of buffer_ in bytes minus one.
+    SizeType capacityMask_{0};
+
+    /// The free-running write location.
+    alignas(cacheLineSize) AtomicSizeType writePosition_{0};
+    /// The free-running position following the last byte the producer may have modified.
+    AtomicSizeType claimPosition_{0};
+    /// Cached read location.
+    SizeType cachedReadPosition_{0};
+    /// The number of unread bytes the producer has overwritten.
+    SizeType overwrittenBytes_{0};
+
+    /// The free-running read location.
+    alignas(cacheLineSize) AtomicSizeType readPosition_{0};
+    /// The number of bytes the consumer has lost to overwrites.
+    SizeType missedBytes_{0};
+    /// The number of times the consumer has been overrun.
+    SizeType overrunCount_{0};
+
+    /// Moves the read position past any data that has been overwritten.
+    void skipOverwritten(SizeType readPos, SizeType claimPos) noexcept [[clang::nonblocking]];
+
+    static_assert(AtomicSizeType::is_always_lock_free, "Lock-free AtomicSizeType required");
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+inline OverwritingRingBuffer::OverwritingRingBuffer(SizeType minCapacity) {
+    if (minCapacity < OverwritingRingBuffer::minCapacity || minCapacity > OverwritingRingBuffer::maxCapacity)
+            [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
+    if (!allocate(minCapacity)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
+
+inline OverwritingRingBuffer::~OverwritingRingBuffer() noexcept { deallocate(); }
+
+// MARK: Buffer Management
+
+inline bool OverwritingRingBuffer::allocate(SizeType minCapacity) noexcept {
+    if (minCapacity < OverwritingRingBuffer::minCapacity || minCapacity > OverwritingRingBuffer::maxCapacity)
+            [[unlikely]] {
+        return false;
+    }
+
+    deallocate();
+
+    const auto capacity = std::bit_ceil(minCapacity);
+    auto *buffer =
+            static_cast<unsigned char *>(::operator new(capacity, std::align_val_t{cacheLineSize}, std::nothrow));
+    if (buffer == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    buffer_ = buffer;
+    capacity_ = capacity;
+    capacityMask_ = capacity - 1;
+
+    return true;
+}
+
+inline void OverwritingRingBuffer::deallocate() noexcept {
+    if (buffer_ != nullptr) [[likely]] {
+        ::operator delete(buffer_, std::align_val_t{cacheLineSize});
+
+        buffer_ = nullptr;
+        capacity_ = 0;
+        capacityMask_ = 0;
+
+        writePosition_.store(0, std::memory_order_relaxed);
+        claimPosition_.store(0, std::memory_order_relaxed);
+        cachedReadPosition_ = 0;
+        overwrittenBytes_ = 0;
+
+        readPosition_.store(0, std::memory_order_relaxed);
+        missedBytes_ = 0;
+        overrunCount_ = 0;
+    }
+}
+
+// MARK: Buffer Information
+
+inline OverwritingRingBuffer::operator bool() const noexcept { return buffer_ != nullptr; }
+
+inline auto OverwritingRingBuffer::capacity() const noexcept -> SizeType { return capacity_; }
+
+// MARK: Overrun Information
+
+inline auto OverwritingRingBuffer::overwrittenBytes() const noexcept -> SizeType { return overwrittenBytes_; }
+
+inline auto OverwritingRingBuffer::missedBytes() const noexcept -> SizeType { return missedBytes_; }
+
+inline auto OverwritingRingBuffer::overrunCount() const noexcept -> SizeType { return overrunCount_; }
+
+// MARK: Writing
+
+inline auto OverwritingRingBuffer::write(const void *const RB_NONNULL ptr, SizeType itemSize,
+                                         SizeType itemCount) noexcept -> SizeType {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity_ == 0) [[unlikely]] {
+        return 0;
+    }
+
+    const auto itemsToWrite = std::min(itemCount, capacity_ / itemSize);
+    if (itemsToWrite == 0) [[unlikely]] {
+        return 0;
+    }
+
+    const auto bytesToWrite = itemsToWrite * itemSize;
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto end = writePos + bytesToWrite;
+
+    // Account for unread data about to be overwritten; the consumer is only consulted when it may be behind
+    if (end - cachedReadPosition_ > capacity_) {
+        cachedReadPosition_ = readPosition_.load(std::memory_order_acquire);
+        if (const auto behind = end - cachedReadPosition_; behind > capacity_) {
+            overwrittenBytes_ += std::min(behind - capacity_, bytesToWrite);
+        }
+    }
+
+    // Announce the overwrite before modifying the data
+    claimPosition_.store(end, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Keep the newest items
+    const auto *src = static_cast<const unsigned char *>(ptr) + (itemCount - itemsToWrite) * itemSize;
+    const auto writeIndex = writePos & capacityMask_;
+    const auto bytesToEnd = capacity_ - writeIndex;
+
+    if (bytesToWrite <= bytesToEnd) [[likely]] {
+        std::memcpy(buffer_ + writeIndex, src, bytesToWrite);
+    } else [[unlikely]] {
+        std::memcpy(buffer_ + writeIndex, src, bytesToEnd);
+        std::memcpy(buffer_, src + bytesToEnd, bytesToWrite - bytesToEnd);
+    }
+
+    writePosition_.store(end, std::memory_order_release);
+    return itemsToWrite;
+}
+
+template <ByteCopyable T> inline auto OverwritingRingBuffer::write(std::span<const T> data) noexcept -> SizeType {
+    return write(data.data(), sizeof(T), data.size());
+}
+
+inline bool OverwritingRingBuffer::write(ValueLike auto const &value) noexcept {
+    return write(static_cast<const void *>(std::addressof(value)), sizeof value, 1) == 1;
+}
+
+// MARK: Reading
+
+inline auto OverwritingRingBuffer::availableBytes() noexcept -> SizeType {
+    if (capacity_ == 0) [[unlikely]] {
+        return 0;
+    }
+    // Loading the claim first guarantees the write position is not behind the skipped-to position
+    auto readPos = readPosition_.load(std::memory_order_relaxed);
+    skipOverwritten(readPos, claimPosition_.load(std::memory_order_acquire));
+    readPos = readPosition_.load(std::memory_order_relaxed);
+    // The producer may have moved more than the capacity past the skipped-to position since the claim was loaded.
+    // Copying is limited to the buffer and the check of the claim after copying detects the overwrite.
+    return std::min(writePosition_.load(std::memory_order_acquire) - readPos, capacity_);
+}
+
+inline auto OverwritingRingBuffer::read(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                        bool allowPartial) noexcept -> SizeType {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity_ == 0) [[unlikely]] {
+        return 0;
+    }
+
+    for (;;) {
+        const auto itemsAvailable = availableBytes() / itemSize;
+
+        if (itemsAvailable == 0 || (itemsAvailable < itemCount && !allowPartial)) {
+            return 0;
+        }
+
+        const auto readPos = readPosition_.load(std::memory_order_relaxed);
+        const auto itemsToRead = std::min(itemsAvailable, itemCount);
+        const auto bytesToRead = itemsToRead * itemSize;
+        auto *dst = static_cast<unsigned char *>(ptr);
+        const auto readIndex = readPos & capacityMask_;
+        const auto bytesToEnd = capacity_ - readIndex;
+
+        if (bytesToRead <= bytesToEnd) [[likely]] {
+            std::memcpy(dst, buffer_ + readIndex, bytesToRead);
+        } else [[unlikely]] {
+            std::memcpy(dst, buffer_ + readIndex, bytesToEnd);
+            std::memcpy(dst + bytesToEnd, buffer_, bytesToRead - bytesToEnd);
+        }
+
+        // Order the preceding reads of the data before checking whether the producer has announced overwriting it
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (const auto claimPos = claimPosition_.load(std::memory_order_relaxed); claimPos - readPos > capacity_)
+                [[unlikely]] {
+            skipOverwritten(readPos, claimPos);
+            continue;
+        }
+
+        readPosition_.store(readPos + bytesToRead, std::memory_order_release);
+        return itemsToRead;
+    }
+}
+
+template <ByteCopyable T>
+inline auto OverwritingRingBuffer::read(std::span<T> buffer, bool allowPartial) noexcept -> SizeType {
+    return read(buffer.data(), sizeof(T), buffer.size(), allowPartial);
+}
+
+inline bool OverwritingRingBuffer::read(ValueLike auto &value) noexcept {
+    return read(std::addressof(value), sizeof value, 1, false) == 1;
+}
+
+inline void OverwritingRingBuffer::skipOverwritten(SizeType readPos, SizeType claimPos) noexcept {
+    if (const auto oldest = claimPos - capacity_; claimPos - readPos > capacity_) {
+        missedBytes_ += oldest - readPos;
+        ++overrunCount_;
+        readPosition_.store(oldest, std::memory_order_release);
+    }
+}
+
+} /* namespace spsc */
+
+#endif
@@ -0,0 +1,234 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_RESIDENCE_STATISTICS_HPP
+#define SPSC_RESIDENCE_STATISTICS_HPP
+
+#include "spsc/RingBuffer.hpp"
+#include "spsc/Statistics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace spsc {
+
+// MARK: Residence Time Sampling
+
+/// Counts residence time samples by magnitude for ``RingBufferStatistics::residenceHistogram``.
+class ResidenceHistogram {
+  public:
+    /// Counts a sample.
+    /// @note This method is only safe to call from one thread.
+    void operator()(std::chrono::nanoseconds residence) noexcept {
+        const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(residence.count(), 0));
+        const auto bucket = std::min<std::size_t>(std::bit_width(nanoseconds), buckets_.size() - 1);
+        detail::increment(buckets_[bucket]);
+    }
+
+    /// Adds the counts to snapshot.
+    void collect(RingBufferStatistics &snapshot) const noexcept {
+        for (std::size_t i = 0; i < buckets_.size(); ++i) {
+            snapshot.residenceHistogram[i] = buckets_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    /// Resets the counts to zero.
+    /// @note This method is not thread safe.
+    void reset() noexcept {
+        for (auto &bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /// Moves the counts of other into this histogram and resets other to zero.
+    /// @note This method is not thread safe.
+    void take(ResidenceHistogram &other) noexcept {
+        for (std::size_t i = 0; i < buckets_.size(); ++i) {
+            detail::take(buckets_[i], other.buckets_[i]);
+        }
+    }
+
+  private:
+    std::array<std::atomic<std::uint64_t>, std::tuple_size_v<decltype(RingBufferStatistics::residenceHistogram)>>
+            buckets_{};
+};
+
+/// Maintains the counters of ``CountingStatistics`` and samples how long data waits in the ring buffer.
+///
+/// Every Interval-th write records the time and the write position at which the written data ends. When the read
+/// position reaches that point the consumer passes the elapsed time to a Sink. Samples are passed from the producer to
+/// the consumer through a small side channel, so only sampled operations touch memory shared by both sides; a sample
+/// taken while the side channel is full is dropped.
+/// @tparam Interval The number of writes per sample.
+/// @tparam Sink A default-constructible callable invoked by the consumer with each residence time as
+/// ``std::chrono::nanoseconds``. If it provides ``collect(RingBufferStatistics &)`` and ``reset()`` it contributes to
+/// snapshots and is reset with the ring buffer; otherwise it must publish its results itself. A Sink moves with the
+/// ring buffer through ``take(Sink &)`` if it provides one and by move assignment otherwise.
+template <std::size_t Interval = 1024, typename Sink = ResidenceHistogram>
+    requires(Interval > 0) && std::default_initializable<Sink> &&
+            std::is_nothrow_invocable_v<Sink &, std::chrono::nanoseconds> &&
+            (requires(Sink &sink) {
+                { sink.take(sink) } noexcept;
+            } || std::is_nothrow_move_assignable_v<Sink>)
+struct ResidenceStatistics {
+    /// The number of samples that may be outstanding at once.
+    static constexpr std::size_t slotCount = 16;
+
+    class Consumer;
+
+    class Producer : public CountingStatistics::Producer {
+      public:
+        void recordWrite(std::size_t writePos, std::size_t count, bool wrapped) noexcept {
+            CountingStatistics::Producer::recordWrite(writePos, count, wrapped);
+            if (++writesSinceSample_ < Interval) [[likely]] {
+                return;
+            }
+            writesSinceSample_ = 0;
+
+            auto &slot = slots_[head_ % slotCount];
+            if (slot.full.load(std::memory_order_acquire)) [[unlikely]] {
+                detail::increment(dropped_);
+                return;
+            }
+            slot.endPosition = writePos + count;
+            slot.timestamp = std::chrono::steady_clock::now();
+            slot.full.store(true, std::memory_order_release);
+            ++head_;
+        }
+
+        void reset() noexcept {
+            CountingStatistics::Producer::reset();
+            writesSinceSample_ = 0;
+            head_ = 0;
+            dropped_.store(0, std::memory_order_relaxed);
+            for (auto &slot : slots_) {
+                slot.full.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        void take(Producer &other) noexcept {
+            CountingStatistics::Producer::take(other);
+            // Outstanding samples refer to the other ring buffer's positions, which are moved along with them
+            writesSinceSample_ = std::exchange(other.writesSinceSample_, 0);
+            head_ = std::exchange(other.head_, 0);
+            detail::take(dropped_, other.dropped_);
+            for (std::size_t i = 0; i < slotCount; ++i) {
+                slots_[i].endPosition = other.slots_[i].endPosition;
+                slots_[i].timestamp = other.slots_[i].timestamp;
+                slots_[i].full.store(other.slots_[i].full.exchange(false, std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+            }
+        }
+
+        void collect(RingBufferStatistics &snapshot) const noexcept {
+            CountingStatistics::Producer::collect(snapshot);
+            snapshot.residenceSamplesDropped = dropped_.load(std::memory_order_relaxed);
+        }
+
+      private:
+        friend class Consumer;
+
+        /// A sample passed from the producer to the consumer.
+        ///
+        /// The consumer polls the next slot on every read, so each slot has its own cache line rather than sharing
+        /// one with the producer's counters.
+        struct alignas(cacheLineSize) Slot {
+            /// The free-running position following the sampled write.
+            std::size_t endPosition{0};
+            /// When the sampled write completed.
+            std::chrono::steady_clock::time_point timestamp{};
+            /// True while the sample is owned by the consumer.
+            std::atomic<bool> full{false};
+        };
+
+        /// The number of writes since the last sample.
+        std::size_t writesSinceSample_{0};
+        /// The number of samples taken, used to select a slot.
+        std::size_t head_{0};
+        /// The number of samples dropped.
+        std::atomic<std::uint64_t> dropped_{0};
+        /// The side channel.
+        std::array<Slot, slotCount> slots_{};
+    };
+
+    class Consumer : public CountingStatistics::Consumer {
+      public:
+        void recordRead(std::size_t readPos, std::size_t count, Producer &producer) noexcept {
+            CountingStatistics::Consumer::recordRead(readPos, count, producer);
+
+            auto &slot = producer.slots_[tail_ % slotCount];
+            if (!slot.full.load(std::memory_order_acquire)) [[likely]] {
+                return;
+            }
+
+            // Samples are published in position order, so all reached samples precede the first unreached one
+            const auto newReadPos = readPos + count;
+            const auto now = std::chrono::steady_clock::now();
+            for (auto *next = &slot; next->full.load(std::memory_order_acquire);
+                 next = &producer.slots_[tail_ % slotCount]) {
+                if (static_cast<std::make_signed_t<std::size_t>>(newReadPos - next->endPosition) < 0) {
+                    break;
+                }
+                sink_(std::chrono::duration_cast<std::chrono::nanoseconds>(now - next->timestamp));
+                detail::increment(samples_);
+                next->full.store(false, std::memory_order_release);
+                ++tail_;
+            }
+        }
+
+        void reset() noexcept {
+            CountingStatistics::Consumer::reset();
+            tail_ = 0;
+            samples_.store(0, std::memory_order_relaxed);
+            if constexpr (requires { sink_.reset(); }) {
+                sink_.reset();
+            }
+        }
+
+        void take(Consumer &other) noexcept {
+            CountingStatistics::Consumer::take(other);
+            tail_ = std::exchange(other.tail_, 0);
+            detail::take(samples_, other.samples_);
+            if constexpr (requires { sink_.take(other.sink_); }) {
+                sink_.take(other.sink_);
+            } else {
+                sink_ = std::exchange(other.sink_, Sink{});
+            }
+        }
+
+        void collect(RingBufferStatistics &snapshot) const noexcept {
+            CountingStatistics::Consumer::collect(snapshot);
+            snapshot.residenceSamples = samples_.load(std::memory_order_relaxed);
+            if constexpr (requires { sink_.collect(snapshot); }) {
+                sink_.collect(snapshot);
+            }
+        }
+
+      private:
+        /// The number of samples consumed, used to select a slot.
+        std::size_t tail_{0};
+        /// The number of samples passed to sink_.
+        std::atomic<std::uint64_t> samples_{0};
+        /// The receiver of residence times.
+        Sink sink_{};
+    };
+};
+
+static_assert(StatisticsPolicy<ResidenceStatistics<>>);
+
+} /* namespace spsc */
+
+#endif
@@ -0,0 +1,438 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_RESIZABLE_RING_BUFFER_HPP
+#define SPSC_RESIZABLE_RING_BUFFER_HPP
+
+#include "spsc/RingBuffer.hpp"
+#include "spsc/Statistics.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace spsc {
+
+/// A lock-free SPSC ring buffer whose capacity may change while it is in use.
+///
+/// This class is thread safe when used with a single producer and a single consumer.
+///
+/// The data is held in a chain of ring buffers called segments. Resizing links a new segment to the one being
+/// written and directs subsequent writes to it; the consumer finishes reading the old segment before following the
+/// link, so data is read in the order it was written. The consumer publishes the segment it is reading, and the
+/// producer frees the segments before it on its next write or resize. Reads therefore never allocate or free memory.
+///
+/// Each write is placed entirely in one segment. Values must be read with the sizes they were written with, since a
+/// segment is only left once it is empty.
+class ResizableRingBuffer final {
+  public:
+    /// Unsigned integer type.
+    using SizeType = RingBuffer::SizeType;
+
+    /// The minimum supported ring buffer capacity in bytes.
+    static constexpr auto minCapacity = RingBuffer::minCapacity;
+    /// The maximum supported ring buffer capacity in bytes.
+    static constexpr auto maxCapacity = RingBuffer::maxCapacity;
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty ring buffer.
+    /// @note ``allocate`` must be called before the object may be used.
+    ResizableRingBuffer() noexcept = default;
+
+    /// Creates a ring buffer with the specified minimum capacity.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param minCapacity The desired minimum capacity in bytes, below which ``trim()`` does not shrink the buffer.
+    /// @param capacityLimit The capacity in bytes beyond which writes do not grow the buffer, rounded up to an integral
+    /// power of two.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
+    /// supported.
+    explicit ResizableRingBuffer(SizeType minCapacity, SizeType capacityLimit = maxCapacity);
+
+    ResizableRingBuffer(const ResizableRingBuffer &) = delete;
+    ResizableRingBuffer &operator=(const ResizableRingBuffer &) = delete;
+
+    /// Creates a ring buffer by moving the contents of another ring buffer.
+    /// @note This method is not thread safe for the ring buffer being moved.
+    /// @param other The ring buffer to move.
+    ResizableRingBuffer(ResizableRingBuffer &&other) noexcept;
+
+    /// Moves the contents of another ring buffer into this ring buffer.
+    /// @note This method is not thread safe.
+    /// @param other The ring buffer to move.
+    ResizableRingBuffer &operator=(ResizableRingBuffer &&other) noexcept;
+
+    /// Destroys the ring buffer and releases all associated resources.
+    ~ResizableRingBuffer() noexcept;
+
+    // MARK: Buffer Management
+
+    /// Allocates space for data, discarding any existing contents.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @note This method is not thread safe.
+    /// @param minCapacity The desired minimum capacity in bytes, below which ``trim()`` does not shrink the buffer.
+    /// @param capacityLimit The capacity in bytes beyond which writes do not grow the buffer, rounded up to an integral
+    /// power of two.
+    /// @return true on success, false if memory could not be allocated or the buffer capacity is not supported.
+    bool allocate(SizeType minCapacity, SizeType capacityLimit = maxCapacity) noexcept [[clang::allocating]];
+
+    /// Frees all space allocated for data.
+    /// @note This method is not thread safe.
+    void deallocate() noexcept;
+
+    /// Directs subsequent writes to a new segment with the specified minimum capacity.
+    ///
+    /// Data already written remains readable and is read before data written afterward. The capacity may be smaller
+    /// than the amount of data in the buffer.
+    /// @note This method is only safe to call from the producer.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @return true on success, false if memory could not be allocated or the capacity is not supported or exceeds
+    /// the capacity limit.
+    bool resize(SizeType minCapacity) noexcept [[clang::allocating]];
+
+    /// Shrinks the buffer if it has been lightly used since it was last resized.
+    ///
+    /// The buffer is resized to twice the largest amount of data it has held since the segment being written was
+    /// created, if that is smaller than its capacity, but not below the minimum capacity it was allocated with. Called
+    /// periodically, this returns the memory of buffers that grew during a burst once traffic subsides.
+    /// @note This method is only safe to call from the producer.
+    /// @return true if the buffer was resized.
+    bool trim() noexcept [[clang::allocating]];
+
+    // MARK: Buffer Information
+
+    /// Returns true if the ring buffer has space for data.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the capacity of the segment being written.
+    /// @note This method is only safe to call from the producer.
+    /// @return The ring buffer capacity in bytes.
+    [[nodiscard]] SizeType capacity() const noexcept [[clang::nonblocking]];
+
+    /// Returns the capacity beyond which writes do not grow the buffer.
+    /// @return The capacity limit in bytes.
+    [[nodiscard]] SizeType capacityLimit() const noexcept [[clang::nonblocking]];
+
+    /// Returns true if the ring buffer contains no data.
+    /// @note The result of this method is only accurate when called from the consumer.
+    /// @return true if no bytes are available for reading.
+    [[nodiscard]] bool isEmpty() const noexcept [[clang::nonblocking]];
+
+    // MARK: Writing
+
+    /// Writes data and advances the write position, growing the buffer if it is full.
+    ///
+    /// If insufficient free space is available the capacity is doubled, or increased to the smallest integral power
+    /// of two that holds the data, up to the capacity limit.
+    /// @note This method is only safe to call from the producer.
+    /// @param ptr An address containing the data to copy.
+    /// @param size The number of bytes to write.
+    /// @return true if the data was written, false if it does not fit within the capacity limit or memory could not be
+    /// allocated.
+    bool write(const void *const RB_NONNULL ptr, SizeType size) noexcept [[clang::allocating]];
+
+    /// Writes a value and advances the write position, growing the buffer if it is full.
+    /// @note This method is only safe to call from the producer.
+    /// @param value The value to write.
+    /// @return true if the value was written, false if it does not fit within the capacity limit or memory could not
+    /// be allocated.
+    bool write(const ValueLike auto &value) noexcept [[clang::allocating]];
+
+    // MARK: Reading
+
+    /// Reads data and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @param ptr An address to receive the data.
+    /// @param size The maximum number of bytes to read.
+    /// @return The number of bytes actually read.
+    SizeType read(void *const RB_NONNULL ptr, SizeType size) noexcept [[clang::nonblocking]];
+
+    /// Reads a value and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @param value The destination value.
+    /// @return true on success, false if no value is available.
+    bool read(ValueLike auto &value) noexcept [[clang::nonblocking]];
+
+  private:
+    /// A ring buffer in the chain.
+    struct Segment {
+        /// The data. Its statistics provide the high water mark used by ``trim()``.
+        BasicRingBuffer<CountingStatistics> ring;
+        /// The segment written after this one, set once by the producer after its last write to this one.
+        std::atomic<Segment *> next{nullptr};
+    };
+
+    /// The segment receiving writes.
+    Segment *RB_NULLABLE writeSegment_{nullptr};
+    /// The oldest segment not yet freed, which begins the chain.
+    Segment *RB_NULLABLE oldestSegment_{nullptr};
+    /// The capacity below which trim() does not shrink the buffer.
+    SizeType minCapacity_{0};
+    /// The capacity beyond which write() does not grow the buffer.
+    SizeType capacityLimit_{0};
+
+    /// The segment being read, published by the consumer so the producer may free the segments before it.
+    alignas(cacheLineSize) std::atomic<Segment *> readSegment_{nullptr};
+
+    /// Returns a new segment with the specified minimum capacity or nullptr if memory could not be allocated.
+    [[nodiscard]] static Segment *RB_NULLABLE makeSegment(SizeType minCapacity) noexcept [[clang::allocating]];
+
+    /// Writes size bytes with tryWrite, growing the buffer and writing again if the segment receiving writes is full.
+    /// @param size The number of bytes tryWrite writes.
+    /// @param tryWrite A function writing the data to a segment's ring buffer and returning true on success.
+    template <typename F> bool writeGrowing(SizeType size, F &&tryWrite) noexcept [[clang::allocating]];
+
+    /// Links a new segment to the segment receiving writes and directs writes to it.
+    bool appendSegment(SizeType minCapacity) noexcept [[clang::allocating]];
+
+    /// Frees the segments the consumer has finished reading.
+    void reclaimSegments() noexcept;
+
+    /// Moves the consumer to the segment following segment if the producer has moved on and segment is empty.
+    /// @return The following segment, or nullptr if the consumer remains on segment.
+    Segment *RB_NULLABLE advance(Segment *RB_NONNULL segment) noexcept [[clang::nonblocking]];
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+inline ResizableRingBuffer::ResizableRingBuffer(SizeType minCapacity, SizeType capacityLimit) {
+    if (minCapacity < ResizableRingBuffer::minCapacity || minCapacity > ResizableRingBuffer::maxCapacity ||
+        capacityLimit < minCapacity || capacityLimit > ResizableRingBuffer::maxCapacity) [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
+    if (!allocate(minCapacity, capacityLimit)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
+
+inline ResizableRingBuffer::ResizableRingBuffer(ResizableRingBuffer &&other) noexcept
+    : writeSegment_{std::exchange(other.writeSegment_, nullptr)},
+      oldestSegment_{std::exchange(other.oldestSegment_, nullptr)},
+      minCapacity_{std::exchange(other.minCapacity_, 0)}, capacityLimit_{std::exchange(other.capacityLimit_, 0)},
+      readSegment_{other.readSegment_.exchange(nullptr, std::memory_order_relaxed)} {}
+
+inline auto ResizableRingBuffer::operator=(ResizableRingBuffer &&other) noexcept -> ResizableRingBuffer & {
+    if (this != &other) [[likely]] {
+        deallocate();
+        writeSegment_ = std::exchange(other.writeSegment_, nullptr);
+        oldestSegment_ = std::exchange(other.oldestSegment_, nullptr);
+        minCapacity_ = std::exchange(other.minCapacity_, 0);
+        capacityLimit_ = std::exchange(other.capacityLimit_, 0);
+        readSegment_.store(other.readSegment_.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    return *this;
+}
+
+inline ResizableRingBuffer::~ResizableRingBuffer() noexcept { deallocate(); }
+
+// MARK: Buffer Management
+
+inline bool ResizableRingBuffer::allocate(SizeType minCapacity, SizeType capacityLimit) noexcept {
+    if (minCapacity < ResizableRingBuffer::minCapacity || minCapacity > ResizableRingBuffer::maxCapacity ||
+        capacityLimit < minCapacity || capacityLimit > ResizableRingBuffer::maxCapacity) [[unlikely]] {
+        return false;
+    }
+
+    deallocate();
+
+    auto *segment = makeSegment(minCapacity);
+    if (segment == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    writeSegment_ = segment;
+    oldestSegment_ = segment;
+    minCapacity_ = minCapacity;
+    capacityLimit_ = std::bit_ceil(capacityLimit);
+    readSegment_.store(segment, std::memory_order_relaxed);
+
+    return true;
+}
+
+inline void ResizableRingBuffer::deallocate() noexcept {
+    while (oldestSegment_ != nullptr) {
+        delete std::exchange(oldestSegment_, oldestSegment_->next.load(std::memory_order_relaxed));
+    }
+
+    writeSegment_ = nullptr;
+    minCapacity_ = 0;
+    capacityLimit_ = 0;
+    readSegment_.store(nullptr, std::memory_order_relaxed);
+}
+
+inline bool ResizableRingBuffer::resize(SizeType minCapacity) noexcept {
+    if (writeSegment_ == nullptr || minCapacity < ResizableRingBuffer::minCapacity || minCapacity > capacityLimit_)
+            [[unlikely]] {
+        return false;
+    }
+
+    reclaimSegments();
+    if (std::bit_ceil(minCapacity) == writeSegment_->ring.capacity()) {
+        return true;
+    }
+    return appendSegment(minCapacity);
+}
+
+inline bool ResizableRingBuffer::trim() noexcept {
+    if (writeSegment_ == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    const auto highWaterMark = static_cast<SizeType>(writeSegment_->ring.statistics().highWaterMark);
+    const auto target = std::bit_ceil(std::max(2 * highWaterMark, minCapacity_));
+    if (target >= writeSegment_->ring.capacity()) {
+        return false;
+    }
+    return resize(target);
+}
+
+// MARK: Buffer Information
+
+inline ResizableRingBuffer::operator bool() const noexcept { return writeSegment_ != nullptr; }
+
+inline auto ResizableRingBuffer::capacity() const noexcept -> SizeType {
+    return writeSegment_ != nullptr ? writeSegment_->ring.capacity() : 0;
+}
+
+inline auto ResizableRingBuffer::capacityLimit() const noexcept -> SizeType { return capacityLimit_; }
+
+inline bool ResizableRingBuffer::isEmpty() const noexcept {
+    // Segments after the one being read are never freed by the producer, so the consumer may inspect them
+    for (auto *segment = readSegment_.load(std::memory_order_relaxed); segment != nullptr;
+         segment = segment->next.load(std::memory_order_acquire)) {
+        if (!segment->ring.isEmpty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// MARK: Writing
+
+inline bool ResizableRingBuffer::write(const void *const ptr, SizeType size) noexcept {
+    if (size == 0) [[unlikely]] {
+        return false;
+    }
+    return writeGrowing(size, [&](auto &ring) noexcept { return ring.write(ptr, 1, size, false) == size; });
+}
+
+inline bool ResizableRingBuffer::write(const ValueLike auto &value) noexcept {
+    return writeGrowing(sizeof value, [&](auto &ring) noexcept { return ring.write(value); });
+}
+
+template <typename F> inline bool ResizableRingBuffer::writeGrowing(SizeType size, F &&tryWrite) noexcept {
+    if (writeSegment_ == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    if (tryWrite(writeSegment_->ring)) [[likely]] {
+        if (oldestSegment_ != writeSegment_) [[unlikely]] {
+            reclaimSegments();
+        }
+        return true;
+    }
+
+    const auto capacity = writeSegment_->ring.capacity();
+    const auto grownCapacity = std::max(2 * capacity, std::bit_ceil(size));
+    if (size > capacityLimit_ || capacity >= capacityLimit_) {
+        return false;
+    }
+
+    reclaimSegments();
+    if (!appendSegment(std::min(grownCapacity, capacityLimit_))) [[unlikely]] {
+        return false;
+    }
+    return tryWrite(writeSegment_->ring);
+}
+
+// MARK: Reading
+
+inline auto ResizableRingBuffer::read(void *const ptr, SizeType size) noexcept -> SizeType {
+    auto *dst = static_cast<unsigned char *>(ptr);
+    SizeType total = 0;
+    for (auto *segment = readSegment_.load(std::memory_order_relaxed); segment != nullptr;
+         segment = advance(segment)) {
+        total += segment->ring.read(dst + total, 1, size - total, true);
+        if (total >= size) [[likely]] {
+            break;
+        }
+    }
+    return total;
+}
+
+inline bool ResizableRingBuffer::read(ValueLike auto &value) noexcept {
+    for (auto *segment = readSegment_.load(std::memory_order_relaxed); segment != nullptr;
+         segment = advance(segment)) {
+        if (segment->ring.read(value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// MARK: Segments
+
+inline auto ResizableRingBuffer::makeSegment(SizeType minCapacity) noexcept -> Segment * {
+    auto *segment = new (std::nothrow) Segment;
+    if (segment == nullptr) [[unlikely]] {
+        return nullptr;
+    }
+    if (!segment->ring.allocate(minCapacity)) [[unlikely]] {
+        delete segment;
+        return nullptr;
+    }
+    return segment;
+}
+
+inline bool ResizableRingBuffer::appendSegment(SizeType minCapacity) noexcept {
+    auto *segment = makeSegment(minCapacity);
+    if (segment == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    // Publishes all writes to the current segment along with the link
+    writeSegment_->next.store(segment, std::memory_order_release);
+    writeSegment_ = segment;
+    return true;
+}
+
+inline void ResizableRingBuffer::reclaimSegments() noexcept {
+    // The consumer publishes a segment only after it has finished reading the ones before it
+    const auto *readSegment = readSegment_.load(std::memory_order_acquire);
+    while (oldestSegment_ != readSegment) {
+        delete std::exchange(oldestSegment_, oldestSegment_->next.load(std::memory_order_relaxed));
+    }
+}
+
+inline auto ResizableRingBuffer::advance(Segment *const segment) noexcept -> Segment * {
+    auto *next = segment->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+        return nullptr;
+    }
+
+    // Data written before the link was published may not have been visible to the last read
+    if (!segment->ring.isEmpty()) {
+        return nullptr;
+    }
+
+    readSegment_.store(next, std::memory_order_release);
+    return next;
+}
+
+} /* namespace spsc */
+
+#endif
@@ -8,17 +8,31 @@
 #ifndef SPSC_RING_BUFFER_HPP
 #define SPSC_RING_BUFFER_HPP
 
+#include "spsc/Copy.hpp"
+#include "spsc/EventNotifier.hpp"
+#include "spsc/Statistics.hpp"
+#include "spsc/WaitStrategy.hpp"
+
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
 #include <cassert>
+#include <chrono>
 #include <concepts>
+#include <coroutine>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <new>
 #include <optional>
 #include <ranges>
 #include <span>
+#include <stdexcept>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -39,6 +53,27 @@
 
 namespace spsc {
 
+/// The assumed size of a cache line in bytes, used to keep producer-owned and consumer-owned state apart.
+///
+/// This value is part of the ABI: it determines the layout of ``RingBufferBase``. Define `RB_CACHE_LINE_SIZE` to pin it
+/// when objects are shared between translation units built with different compilers or tuning flags.
+#if defined(RB_CACHE_LINE_SIZE)
+inline constexpr std::size_t cacheLineSize = RB_CACHE_LINE_SIZE;
+#elif defined(__cpp_lib_hardware_interference_size)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+inline constexpr std::size_t cacheLineSize = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+inline constexpr std::size_t cacheLineSize = 64;
+#endif
+
+static_assert(cacheLineSize > 0 && (cacheLineSize & (cacheLineSize - 1)) == 0, "cacheLineSize must be a power of two");
+
 template <typename T>
 concept ByteCopyable =
         std::is_object_v<std::remove_cvref_t<T>> && std::is_trivially_copyable_v<std::remove_cvref_t<T>> &&
@@ -47,13 +82,43 @@ concept ByteCopyable =
 template <typename T>
 concept ValueLike = ByteCopyable<T> && !std::ranges::range<std::remove_cvref_t<T>>;
 
-/// A lock-free SPSC ring buffer.
+/// Describes a ring buffer type to ``RingBufferBase``.
+///
+/// Specialize this template to choose the statistics policy of a ring buffer type. A specialization may also define
+/// ``static constexpr bool processShared = true`` for a ring buffer in memory shared between processes, which makes
+/// the awaiting and event notifier methods unavailable because they publish process-local addresses.
+/// @tparam Derived The ring buffer type.
+template <typename Derived> struct RingBufferTraits {
+    /// The statistics policy, which must satisfy ``StatisticsPolicy``.
+    using Statistics = NoStatistics;
+};
+
+namespace detail {
+
+/// True if ``RingBufferTraits<Derived>`` declares the ring buffer shared between processes.
+template <typename Derived>
+inline constexpr bool isProcessShared = requires { requires RingBufferTraits<Derived>::processShared; };
+
+} /* namespace detail */
+
+class RingSet;
+
+/// The operations shared by lock-free SPSC ring buffers of bytes.
 ///
 /// This class is thread safe when used with a single producer and a single consumer.
 ///
-/// This ring buffer performs raw byte copies; it does not provide serialization.
-class RingBuffer final {
+/// The producer-owned and consumer-owned positions each occupy their own cache line so that stores by one side do not
+/// invalidate cache lines the other side reads. Each side also keeps a private copy of the other side's position and
+/// only reloads the shared position when its copy indicates insufficient space or data.
+/// @tparam Derived The ring buffer type, which provides ``storageData()``, ``storageCapacity()``, ``storageMask()``,
+/// and ``storageExtent()`` to describe the memory holding the data. Its statistics policy is given by
+/// ``RingBufferTraits<Derived>``.
+template <typename Derived> class RingBufferBase {
   public:
+    /// The statistics policy.
+    using Statistics = typename RingBufferTraits<Derived>::Statistics;
+    static_assert(StatisticsPolicy<Statistics>, "RingBufferTraits<Derived>::Statistics must be a statistics policy");
+
     /// Unsigned integer type.
     using SizeType = std::size_t;
     /// Atomic unsigned integer type.
@@ -69,62 +134,21 @@ class RingBuffer final {
     /// The maximum supported ring buffer capacity in bytes.
     static constexpr auto maxCapacity = SizeType{1} << (std::numeric_limits<SizeType>::digits - 1);
 
-    // MARK: Construction and Destruction
-
-    /// Creates an empty ring buffer.
-    /// @note ``allocate`` must be called before the object may be used.
-    RingBuffer() noexcept = default;
-
-    /// Creates a ring buffer with the specified minimum capacity.
-    ///
-    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
-    /// minimum capacity.
-    /// @param minCapacity The desired minimum capacity in bytes.
-    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
-    /// supported.
-    explicit RingBuffer(SizeType minCapacity);
-
-    RingBuffer(const RingBuffer &) = delete;
-    RingBuffer &operator=(const RingBuffer &) = delete;
-
-    /// Creates a ring buffer by moving the contents of another ring buffer.
-    /// @note This method is not thread safe for the ring buffer being moved.
-    /// @param other The ring buffer to move.
-    RingBuffer(RingBuffer &&other) noexcept;
-
-    /// Moves the contents of another ring buffer into this ring buffer.
-    /// @note This method is not thread safe.
-    /// @param other The ring buffer to move.
-    RingBuffer &operator=(RingBuffer &&other) noexcept;
-
-    /// Destroys the ring buffer and releases all associated resources.
-    ~RingBuffer() noexcept;
-
-    // MARK: Buffer Management
-
-    /// Allocates space for data.
-    ///
-    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
-    /// minimum capacity.
-    /// @note This method is not thread safe.
-    /// @param minCapacity The desired minimum capacity in bytes.
-    /// @return true on success, false if memory could not be allocated or the buffer capacity is not supported.
-    bool allocate(SizeType minCapacity) noexcept [[clang::allocating]];
-
-    /// Frees any space allocated for data.
-    /// @note This method is not thread safe.
-    void deallocate() noexcept;
+    // MARK: Buffer Information
 
-    /// Returns true if the ring buffer has allocated space for data.
+    /// Returns true if the ring buffer has space for data.
     [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
 
-    // MARK: Buffer Information
-
     /// Returns the capacity of the ring buffer.
     /// @note This method is safe to call from both producer and consumer.
     /// @return The ring buffer capacity in bytes.
     [[nodiscard]] SizeType capacity() const noexcept [[clang::nonblocking]];
 
+    /// Returns true if the ring buffer's pages are mapped twice in adjacent virtual memory.
+    /// @note This method is safe to call from both producer and consumer.
+    /// @return true if all readable and writable regions are contiguous.
+    [[nodiscard]] bool isMirrored() const noexcept [[clang::nonblocking]];
+
     /// Returns the current write position in the ring buffer.
     /// @note The result of this method is only accurate when called from the producer.
     /// @return The current write position in bytes.
@@ -157,6 +181,15 @@ class RingBuffer final {
     /// @return true if the buffer contains no data.
     [[nodiscard]] bool isEmpty() const noexcept [[clang::nonblocking]];
 
+    // MARK: Statistics
+
+    /// Returns a snapshot of the usage counters.
+    /// @note This method is safe to call from any thread. Each counter is read atomically, but counters maintained by
+    /// different sides are not read as a consistent set.
+    /// @return The usage counters.
+    [[nodiscard]] RingBufferStatistics statistics() const noexcept [[clang::nonblocking]]
+        requires(!std::is_same_v<Statistics, NoStatistics>);
+
     // MARK: Writing
 
     /// Writes data and advances the write position.
@@ -166,9 +199,11 @@ class RingBuffer final {
     /// @param itemCount The desired number of items to write.
     /// @param allowPartial Whether any items should be written if insufficient free space is available to write all
     /// items.
+    /// @param mode How the data is copied into the ring buffer. ``CopyMode::streaming`` keeps large writes from
+    /// evicting the producer's working set from the cache.
     /// @return The number of items actually written.
-    SizeType write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, bool allowPartial) noexcept
-            [[clang::nonblocking]];
+    SizeType write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, bool allowPartial,
+                   CopyMode mode = CopyMode::standard) noexcept [[clang::nonblocking]];
 
     /// Writes items and advances the write position.
     /// @note This method is only safe to call from the producer.
@@ -176,9 +211,11 @@ class RingBuffer final {
     /// @param data A span containing the items to copy.
     /// @param allowPartial Whether any items should be written if insufficient free space is available to write all
     /// items.
+    /// @param mode How the data is copied into the ring buffer.
     /// @return The number of items actually written.
     template <ByteCopyable T>
-    SizeType write(std::span<const T> data, bool allowPartial = true) noexcept [[clang::nonblocking]];
+    SizeType write(std::span<const T> data, bool allowPartial = true, CopyMode mode = CopyMode::standard) noexcept
+            [[clang::nonblocking]];
 
     /// Writes a value and advances the write position.
     /// @note This method is only safe to call from the producer.
@@ -195,6 +232,17 @@ class RingBuffer final {
         requires(sizeof...(Args) > 1)
     bool writeAll(const Args &...args) noexcept [[clang::nonblocking]];
 
+    /// Writes data gathered from multiple fragments and advances the write position once.
+    ///
+    /// The fragments are copied in order and published together, so the consumer never observes only some of them.
+    /// @note This method is only safe to call from the producer.
+    /// @param fragments The data to copy.
+    /// @param allowPartial Whether any bytes should be written if insufficient free space is available to write all
+    /// fragments.
+    /// @return The number of bytes actually written.
+    SizeType writev(std::span<const std::span<const std::byte>> fragments, bool allowPartial = true) noexcept
+            [[clang::nonblocking]];
+
     // MARK: Reading
 
     /// Reads data and advances the read position.
@@ -204,9 +252,11 @@ class RingBuffer final {
     /// @param itemCount The desired number of items to read.
     /// @param allowPartial Whether any items should be read if the number of items available to read is less than
     /// itemCount.
+    /// @param mode How the data is copied out of the ring buffer. ``CopyMode::prefetch`` prefetches large reads ahead
+    /// of the copy and ``CopyMode::streaming`` keeps them from evicting the consumer's working set from the cache.
     /// @return The number of items actually read.
-    SizeType read(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, bool allowPartial) noexcept
-            [[clang::nonblocking]];
+    SizeType read(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, bool allowPartial,
+                  CopyMode mode = CopyMode::standard) noexcept [[clang::nonblocking]];
 
     /// Reads items and advances the read position.
     /// @note This method is only safe to call from the consumer.
@@ -214,9 +264,11 @@ class RingBuffer final {
     /// @param buffer A span to receive the items.
     /// @param allowPartial Whether any items should be read if the number of items available to read is less than
     /// buffer.size().
+    /// @param mode How the data is copied out of the ring buffer.
     /// @return The number of items actually read.
     template <ByteCopyable T>
-    SizeType read(std::span<T> buffer, bool allowPartial = true) noexcept [[clang::nonblocking]];
+    SizeType read(std::span<T> buffer, bool allowPartial = true, CopyMode mode = CopyMode::standard) noexcept
+            [[clang::nonblocking]];
 
     /// Reads a value and advances the read position.
     /// @note This method is only safe to call from the consumer.
@@ -251,6 +303,17 @@ class RingBuffer final {
         requires(sizeof...(Args) > 1) && (std::default_initializable<Args> && ...)
     std::optional<std::tuple<Args...>> readAll() noexcept((std::is_nothrow_default_constructible_v<Args> && ...));
 
+    /// Reads data scattered into multiple buffers and advances the read position once.
+    ///
+    /// The buffers are filled in order.
+    /// @note This method is only safe to call from the consumer.
+    /// @param buffers The buffers to receive the data.
+    /// @param allowPartial Whether any bytes should be read if the number of bytes available to read is less than the
+    /// total size of buffers.
+    /// @return The number of bytes actually read.
+    SizeType readv(std::span<const std::span<std::byte>> buffers, bool allowPartial = true) noexcept
+            [[clang::nonblocking]];
+
     // MARK: Peeking
 
     /// Reads data without advancing the read position.
@@ -332,6 +395,16 @@ class RingBuffer final {
     /// @return A pair of spans containing the current writable space.
     [[nodiscard]] WriteVector writeVector() const noexcept [[clang::nonblocking]];
 
+    /// Returns a write vector containing the current writable space, which is at least count bytes if that much is
+    /// available.
+    ///
+    /// Unlike ``writeVector()`` the consumer's position is only reloaded if fewer than count bytes are known to be
+    /// free, so the result may understate the writable space.
+    /// @note This method is only safe to call from the producer.
+    /// @param count The number of bytes of writable space required.
+    /// @return A pair of spans containing the current writable space.
+    [[nodiscard]] WriteVector writeVector(SizeType count) const noexcept [[clang::nonblocking]];
+
     /// Finalizes a write transaction by writing staged data to the ring buffer.
     /// @warning The behavior is undefined if count is greater than the free space in the write vector.
     /// @note This method is only safe to call from the producer.
@@ -343,408 +416,2475 @@ class RingBuffer final {
     /// @return A pair of spans containing the current readable data.
     [[nodiscard]] ReadVector readVector() const noexcept [[clang::nonblocking]];
 
+    /// Returns a read vector containing the current readable data, which is at least count bytes if that much is
+    /// available.
+    ///
+    /// Unlike ``readVector()`` the producer's position is only reloaded if fewer than count bytes are known to be
+    /// available, so the result may understate the readable data.
+    /// @note This method is only safe to call from the consumer.
+    /// @param count The number of bytes of readable data required.
+    /// @return A pair of spans containing the current readable data.
+    [[nodiscard]] ReadVector readVector(SizeType count) const noexcept [[clang::nonblocking]];
+
     /// Finalizes a read transaction by removing data from the front of the ring buffer.
     /// @warning The behavior is undefined if count is greater than the available data in the read vector.
     /// @note This method is only safe to call from the consumer.
     /// @param count The number of bytes that were successfully read from the read vector.
     void commitRead(SizeType count) noexcept [[clang::nonblocking]];
 
-  private:
-    /// The memory buffer holding the data.
-    void *RB_NULLABLE buffer_{nullptr};
+    // MARK: Typed Writing and Reading
 
-    /// The capacity of buffer_ in bytes.
-    SizeType capacity_{0};
-    /// The capacity of buffer_ in bytes minus one.
-    SizeType capacityMask_{0};
+    /// Returns a write vector containing the current writable space as whole elements of type T.
+    ///
+    /// No element straddles the end of the memory buffer and every element is suitably aligned, so the spans may be
+    /// processed in place. This holds if the write position is a multiple of sizeof(T) and either the capacity is a
+    /// multiple of sizeof(T), as it is for any power-of-two size no larger than the capacity, or the buffer is
+    /// mirrored. The result is empty otherwise, which can only happen if data of other sizes has been written.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam T The element type.
+    /// @return A pair of spans containing the current writable space.
+    template <ByteCopyable T>
+    [[nodiscard]] std::pair<std::span<T>, std::span<T>> writeVector() const noexcept [[clang::nonblocking]];
 
-    /// The free-running write location.
-    AtomicSizeType writePosition_{0};
-    /// The free-running read location.
-    AtomicSizeType readPosition_{0};
+    /// Finalizes a write transaction by writing staged elements to the ring buffer.
+    /// @warning The behavior is undefined if count is greater than the size of the typed write vector.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam T The element type.
+    /// @param count The number of elements that were successfully written to the write vector.
+    template <ByteCopyable T> void commitWrite(SizeType count) noexcept [[clang::nonblocking]];
 
-    static_assert(AtomicSizeType::is_always_lock_free, "Lock-free AtomicSizeType required");
-};
+    /// Returns a read vector containing the current readable data as whole elements of type T.
+    ///
+    /// No element straddles the end of the memory buffer and every element is suitably aligned, so the spans may be
+    /// processed in place. This holds under the same conditions as for ``writeVector<T>()`` applied to the read
+    /// position; the result is empty otherwise.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam T The element type.
+    /// @return A pair of spans containing the current readable data.
+    template <ByteCopyable T>
+    [[nodiscard]] std::pair<std::span<const T>, std::span<const T>> readVector() const noexcept [[clang::nonblocking]];
 
-// MARK: - Implementation -
+    /// Finalizes a read transaction by removing elements from the front of the ring buffer.
+    /// @warning The behavior is undefined if count is greater than the size of the typed read vector.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam T The element type.
+    /// @param count The number of elements that were successfully read from the read vector.
+    template <ByteCopyable T> void commitRead(SizeType count) noexcept [[clang::nonblocking]];
 
-// MARK: Buffer Management
+    // MARK: In-Place Processing
 
-inline RingBuffer::operator bool() const noexcept { return buffer_ != nullptr; }
+    /// Passes the current writable space to a function that fills it in place, then publishes what it produced.
+    ///
+    /// The function is called with each region of the write vector in turn and returns the number of bytes it wrote
+    /// at the start of the region. A return value less than the region size ends production. The total is committed
+    /// once, after the last call; the return value is clamped to the region size.
+    /// @note This method is only safe to call from the producer.
+    /// @param f The function filling free space.
+    /// @return The number of bytes produced.
+    /// @throw Any exceptions thrown by f, in which case nothing is committed.
+    template <typename F>
+        requires std::is_invocable_r_v<SizeType, F &, std::span<std::byte>>
+    SizeType produce(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<std::byte>>);
+
+    /// Passes the current writable space as whole elements of type T to a function that fills it in place, then
+    /// publishes what it produced.
+    ///
+    /// This is the typed counterpart of ``produce(F &&)`` using the regions of ``writeVector<T>()``.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam T The element type.
+    /// @param f The function filling free space, returning the number of elements produced.
+    /// @return The number of elements produced.
+    /// @throw Any exceptions thrown by f, in which case nothing is committed.
+    template <ByteCopyable T, typename F>
+        requires std::is_invocable_r_v<SizeType, F &, std::span<T>>
+    SizeType produce(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<T>>);
+
+    /// Passes the current readable data to a function that processes it in place, then removes what it consumed.
+    ///
+    /// The function is called with each region of the read vector in turn and returns the number of bytes it
+    /// consumed from the start of the region. A return value less than the region size ends consumption. The total
+    /// is committed once, after the last call; the return value is clamped to the region size.
+    /// @note This method is only safe to call from the consumer.
+    /// @param f The function processing readable data.
+    /// @return The number of bytes consumed.
+    /// @throw Any exceptions thrown by f, in which case nothing is committed.
+    template <typename F>
+        requires std::is_invocable_r_v<SizeType, F &, std::span<const std::byte>>
+    SizeType consume(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<const std::byte>>);
+
+    /// Passes the current readable data as whole elements of type T to a function that processes it in place, then
+    /// removes what it consumed.
+    ///
+    /// This is the typed counterpart of ``consume(F &&)`` using the regions of ``readVector<T>()``.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam T The element type.
+    /// @param f The function processing readable data, returning the number of elements consumed.
+    /// @return The number of elements consumed.
+    /// @throw Any exceptions thrown by f, in which case nothing is committed.
+    template <ByteCopyable T, typename F>
+        requires std::is_invocable_r_v<SizeType, F &, std::span<const T>>
+    SizeType consume(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<const T>>);
 
-// MARK: Buffer Information
+    // MARK: Blocking Writing and Reading
 
-inline auto RingBuffer::capacity() const noexcept -> SizeType { return capacity_; }
+    /// Writes data, blocking until sufficient free space is available, and advances the write position.
+    ///
+    /// A consumer blocked in ``readWait`` or ``readFor`` is woken after the data is written.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam W The wait strategy type.
+    /// @param ptr An address containing the data to copy.
+    /// @param itemSize The size of an individual item in bytes.
+    /// @param itemCount The number of items to write.
+    /// @param strategy The wait strategy used while the ring buffer is full.
+    /// @return true if the items were written, false if they can never fit in the ring buffer.
+    template <typename W = ParkWait>
+        requires WaitStrategy<std::remove_cvref_t<W>>
+    bool writeWait(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, W &&strategy = {}) noexcept
+            [[clang::blocking]];
+
+    /// Writes items, blocking until sufficient free space is available, and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam T The type to write.
+    /// @tparam W The wait strategy type.
+    /// @param data A span containing the items to copy.
+    /// @param strategy The wait strategy used while the ring buffer is full.
+    /// @return true if the items were written, false if they can never fit in the ring buffer.
+    template <ByteCopyable T, typename W = ParkWait>
+        requires WaitStrategy<std::remove_cvref_t<W>>
+    bool writeWait(std::span<const T> data, W &&strategy = {}) noexcept [[clang::blocking]];
 
-inline auto RingBuffer::writePosition() const noexcept -> SizeType {
-    return writePosition_.load(std::memory_order_relaxed);
-}
+    /// Writes a value, blocking until sufficient free space is available, and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @tparam W The wait strategy type.
+    /// @param value The value to write.
+    /// @param strategy The wait strategy used while the ring buffer is full.
+    /// @return true if value was written, false if it can never fit in the ring buffer.
+    template <typename W = ParkWait>
+        requires WaitStrategy<std::remove_cvref_t<W>>
+    bool writeWait(ValueLike auto const &value, W &&strategy = {}) noexcept [[clang::blocking]];
 
-inline auto RingBuffer::readPosition() const noexcept -> SizeType {
-    return readPosition_.load(std::memory_order_relaxed);
-}
+    /// Reads data, blocking until sufficient data is available, and advances the read position.
+    ///
+    /// A producer blocked in ``writeWait`` is woken after the data is read.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam W The wait strategy type.
+    /// @param ptr An address to receive the data.
+    /// @param itemSize The size of an individual item in bytes.
+    /// @param itemCount The number of items to read.
+    /// @param strategy The wait strategy used while insufficient data is available.
+    /// @return true if the items were read, false if they can never fit in the ring buffer.
+    template <typename W = ParkWait>
+        requires WaitStrategy<std::remove_cvref_t<W>>
+    bool readWait(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, W &&strategy = {}) noexcept
+            [[clang::blocking]];
+
+    /// Reads items, blocking until sufficient data is available, and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam T The type to read.
+    /// @tparam W The wait strategy type.
+    /// @param buffer A span to receive the items.
+    /// @param strategy The wait strategy used while insufficient data is available.
+    /// @return true if the items were read, false if they can never fit in the ring buffer.
+    template <ByteCopyable T, typename W = ParkWait>
+        requires WaitStrategy<std::remove_cvref_t<W>>
+    bool readWait(std::span<T> buffer, W &&strategy = {}) noexcept [[clang::blocking]];
 
-// MARK: Buffer Usage
+    /// Reads a value, blocking until sufficient data is available, and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam W The wait strategy type.
+    /// @param value The destination value.
+    /// @param strategy The wait strategy used while insufficient data is available.
+    /// @return true if value was read, false if it can never fit in the ring buffer.
+    template <typename W = ParkWait>
+        requires WaitStrategy<std::remove_cvref_t<W>>
+    bool readWait(ValueLike auto &value, W &&strategy = {}) noexcept [[clang::blocking]];
 
-inline auto RingBuffer::freeSpace() const noexcept -> SizeType {
-    const auto writePos = writePosition_.load(std::memory_order_relaxed);
-    const auto readPos = readPosition_.load(std::memory_order_acquire);
-    return capacity_ - (writePos - readPos);
-}
+    /// Reads data, blocking until sufficient data is available or a timeout elapses, and advances the read position.
+    ///
+    /// A producer blocked in ``writeWait`` is woken after the data is read.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam W The wait strategy type.
+    /// @param ptr An address to receive the data.
+    /// @param itemSize The size of an individual item in bytes.
+    /// @param itemCount The number of items to read.
+    /// @param timeout The maximum time to wait.
+    /// @param strategy The wait strategy used while insufficient data is available.
+    /// @return true if the items were read, false if the timeout elapsed or they can never fit in the ring buffer.
+    template <typename Rep, typename Period, typename W = ParkWait>
+        requires WaitStrategy<std::remove_cvref_t<W>>
+    bool readFor(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                 const std::chrono::duration<Rep, Period> &timeout, W &&strategy = {}) noexcept [[clang::blocking]];
+
+    /// Reads a value, blocking until sufficient data is available or a timeout elapses, and advances the read
+    /// position.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam W The wait strategy type.
+    /// @param value The destination value.
+    /// @param timeout The maximum time to wait.
+    /// @param strategy The wait strategy used while insufficient data is available.
+    /// @return true if value was read, false if the timeout elapsed.
+    template <typename Rep, typename Period, typename W = ParkWait>
+        requires WaitStrategy<std::remove_cvref_t<W>>
+    bool readFor(ValueLike auto &value, const std::chrono::duration<Rep, Period> &timeout, W &&strategy = {}) noexcept
+            [[clang::blocking]];
+
+    /// Reads a value, blocking until sufficient data is available or a timeout elapses, and advances the read
+    /// position.
+    /// @note This method is only safe to call from the consumer.
+    /// @tparam T The type to read.
+    /// @tparam W The wait strategy type.
+    /// @param timeout The maximum time to wait.
+    /// @param strategy The wait strategy used while insufficient data is available.
+    /// @return A std::optional containing an instance of T if a value was read before the timeout elapsed.
+    /// @throw Any exceptions thrown by the default constructor of T.
+    template <ValueLike T, typename Rep, typename Period, typename W = ParkWait>
+        requires std::default_initializable<T> && WaitStrategy<std::remove_cvref_t<W>>
+    std::optional<T> readFor(const std::chrono::duration<Rep, Period> &timeout, W &&strategy = {}) noexcept(
+            std::is_nothrow_default_constructible_v<T>) [[clang::blocking]];
 
-inline bool RingBuffer::isFull() const noexcept {
-    const auto writePos = writePosition_.load(std::memory_order_relaxed);
-    const auto readPos = readPosition_.load(std::memory_order_acquire);
-    return (writePos - readPos) == capacity_;
-}
+    /// Wakes the consumer if it is blocked waiting for data.
+    ///
+    /// The non-blocking write methods never wake the consumer. A producer using them alongside a blocking consumer
+    /// calls this method after writing. It does not make a system call unless the consumer is blocked.
+    /// @note This method is only safe to call from the producer.
+    void notifyConsumer() noexcept;
 
-inline auto RingBuffer::availableBytes() const noexcept -> SizeType {
-    const auto writePos = writePosition_.load(std::memory_order_acquire);
-    const auto readPos = readPosition_.load(std::memory_order_relaxed);
-    return writePos - readPos;
-}
+    /// Wakes the producer if it is blocked waiting for free space.
+    ///
+    /// The non-blocking read methods never wake the producer. A consumer using them alongside a blocking producer
+    /// calls this method after reading. It does not make a system call unless the producer is blocked.
+    /// @note This method is only safe to call from the consumer.
+    void notifyProducer() noexcept;
 
-inline bool RingBuffer::isEmpty() const noexcept {
-    const auto writePos = writePosition_.load(std::memory_order_acquire);
-    const auto readPos = readPosition_.load(std::memory_order_relaxed);
-    return writePos == readPos;
-}
+    // MARK: Awaiting
 
-// MARK: Writing
+    /// An awaitable that suspends a coroutine until the ring buffer holds at least a number of bytes of data, or of
+    /// free space if Space is true.
+    ///
+    /// The suspended coroutine is stored in the awaiter, so awaiting never allocates, and the other side resumes it
+    /// from ``notifyConsumer`` or ``notifyProducer`` once the condition holds. It is resumed on the notifying thread
+    /// unless a scheduler was provided, in which case its handle is passed to the scheduler instead.
+    ///
+    /// The result of `co_await` is true if the condition holds, or false if it never can because the number of bytes
+    /// exceeds the capacity.
+    /// @note Only one coroutine may await each side of the ring buffer at a time.
+    /// @note Awaiting publishes the address of a process-local continuation to the other side, so neither awaiting
+    /// nor event notifiers are available for ring buffers shared between processes.
+    template <bool Space> class Awaiter {
+      public:
+        Awaiter(const Awaiter &) = delete;
+        Awaiter &operator=(const Awaiter &) = delete;
+
+        /// Returns true if the condition holds or never can.
+        [[nodiscard]] bool await_ready() const noexcept [[clang::nonblocking]];
+
+        /// Publishes the coroutine to the other side, returning false if the condition held by then.
+        bool await_suspend(std::coroutine_handle<> coroutine) noexcept [[clang::nonblocking]];
+
+        /// Returns true if the condition holds.
+        [[nodiscard]] bool await_resume() const noexcept [[clang::nonblocking]];
+
+      private:
+        friend class RingBufferBase;
+
+        Awaiter(RingBufferBase &ring, detail::Continuation continuation) noexcept;
+
+        /// The ring buffer being awaited.
+        RingBufferBase &ring_;
+        /// The suspended coroutine and the number of bytes it requires.
+        detail::Continuation continuation_;
+    };
 
-inline auto RingBuffer::write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
-                              bool allowPartial) noexcept -> SizeType {
-    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity_ == 0) [[unlikely]] {
-        return 0;
-    }
+    /// An awaitable that suspends a consumer coroutine until data is available.
+    using ReadableAwaiter = Awaiter<false>;
+    /// An awaitable that suspends a producer coroutine until free space is available.
+    using WritableAwaiter = Awaiter<true>;
 
-    const auto writePos = writePosition_.load(std::memory_order_relaxed);
-    const auto readPos = readPosition_.load(std::memory_order_acquire);
-    const auto bytesUsed = writePos - readPos;
-    const auto bytesFree = capacity_ - bytesUsed;
-    const auto itemsFree = bytesFree / itemSize;
+    /// Returns an awaitable that suspends the calling coroutine until at least count bytes are available for reading.
+    ///
+    /// The coroutine is resumed by the producer's next ``notifyConsumer``, or blocking write, after which the data
+    /// is available.
+    /// @note This method is only safe to call from the consumer.
+    /// @param count The number of bytes of data required.
+    /// @return An awaitable that resumes the coroutine on the producer's thread.
+    [[nodiscard]] ReadableAwaiter readable(SizeType count = 1) noexcept [[clang::nonblocking]]
+        requires(!detail::isProcessShared<Derived>);
 
-    if (itemsFree == 0 || (itemsFree < itemCount && !allowPartial)) {
-        return 0;
-    }
+    /// Returns an awaitable that suspends the calling coroutine until at least count bytes are available for reading.
+    /// @note This method is only safe to call from the consumer.
+    /// @param count The number of bytes of data required.
+    /// @param scheduler A function that must not block, called on the producer's thread with the coroutine to resume.
+    /// @return An awaitable that passes the coroutine to the scheduler.
+    template <typename S>
+        requires std::is_nothrow_invocable_v<S &, std::coroutine_handle<>> && (!detail::isProcessShared<Derived>)
+    [[nodiscard]] ReadableAwaiter readable(SizeType count, S &scheduler) noexcept [[clang::nonblocking]];
+
+    /// Returns an awaitable that suspends the calling coroutine until at least count bytes of free space are available.
+    ///
+    /// The coroutine is resumed by the consumer's next ``notifyProducer``, or blocking read, after which the space is
+    /// free.
+    /// @note This method is only safe to call from the producer.
+    /// @param count The number of bytes of free space required.
+    /// @return An awaitable that resumes the coroutine on the consumer's thread.
+    [[nodiscard]] WritableAwaiter writable(SizeType count = 1) noexcept [[clang::nonblocking]]
+        requires(!detail::isProcessShared<Derived>);
 
-    const auto itemsToWrite = std::min(itemsFree, itemCount);
-    const auto bytesToWrite = itemsToWrite * itemSize;
-    auto *dst = static_cast<unsigned char *>(buffer_);
-    const auto *src = static_cast<const unsigned char *>(ptr);
-    const auto writeIndex = writePos & capacityMask_;
-    const auto bytesToEnd = capacity_ - writeIndex;
+    /// Returns an awaitable that suspends the calling coroutine until at least count bytes of free space are available.
+    /// @note This method is only safe to call from the producer.
+    /// @param count The number of bytes of free space required.
+    /// @param scheduler A function that must not block, called on the consumer's thread with the coroutine to resume.
+    /// @return An awaitable that passes the coroutine to the scheduler.
+    template <typename S>
+        requires std::is_nothrow_invocable_v<S &, std::coroutine_handle<>> && (!detail::isProcessShared<Derived>)
+    [[nodiscard]] WritableAwaiter writable(SizeType count, S &scheduler) noexcept [[clang::nonblocking]];
+
+    /// Arms a notifier to be signaled once data is available for reading.
+    ///
+    /// The producer signals the notifier from its next ``notifyConsumer``, or blocking write, and disarms it.
+    /// @note This method is only safe to call from the consumer.
+    /// @note The notifier uses the same slot as ``readable``, so it must not be armed while a coroutine awaits data.
+    /// @param notifier The notifier to arm, which must remain open while it is armed.
+    /// @return true if the notifier was armed, false if data is already available.
+    bool armReadable(EventNotifier &notifier) noexcept [[clang::nonblocking]]
+        requires(!detail::isProcessShared<Derived>);
 
-    if (bytesToWrite <= bytesToEnd) [[likely]] {
-        std::memcpy(dst + writeIndex, src, bytesToWrite);
-    } else [[unlikely]] {
-        std::memcpy(dst + writeIndex, src, bytesToEnd);
-        std::memcpy(dst, src + bytesToEnd, bytesToWrite - bytesToEnd);
-    }
+    /// Arms a notifier to be signaled once free space is available for writing.
+    ///
+    /// The consumer signals the notifier from its next ``notifyProducer``, or blocking read, and disarms it.
+    /// @note This method is only safe to call from the producer.
+    /// @note The notifier uses the same slot as ``writable``, so it must not be armed while a coroutine awaits space.
+    /// @param notifier The notifier to arm, which must remain open while it is armed.
+    /// @return true if the notifier was armed, false if free space is already available.
+    bool armWritable(EventNotifier &notifier) noexcept [[clang::nonblocking]]
+        requires(!detail::isProcessShared<Derived>);
 
-    writePosition_.store(writePos + bytesToWrite, std::memory_order_release);
-    return itemsToWrite;
-}
+    /// Disarms a notifier armed with ``armReadable`` or ``armWritable``.
+    ///
+    /// If the other side is notifying concurrently this method waits for it to finish, so the notifier may be closed
+    /// once this method returns.
+    /// @param notifier The notifier to disarm.
+    void disarm(EventNotifier &notifier) noexcept [[clang::nonblocking]] requires(!detail::isProcessShared<Derived>);
 
-template <ByteCopyable T>
-inline auto RingBuffer::write(std::span<const T> data, bool allowPartial) noexcept -> SizeType {
-    return write(data.data(), sizeof(T), data.size(), allowPartial);
-}
+    // MARK: Batched Writing and Reading
 
-inline bool RingBuffer::write(ValueLike auto const &value) noexcept {
-    return write(static_cast<const void *>(std::addressof(value)), sizeof value, 1, false) == 1;
-}
+    /// A sequence of writes published to the consumer with a single store to the write position.
+    ///
+    /// Data appended to a batch is copied into the ring buffer immediately but is not visible to the consumer until
+    /// the batch is committed, either explicitly or when the batch is destroyed.
+    /// @note This class is only safe to use from the producer, and only one batch may be active at a time.
+    class WriteBatch {
+      public:
+        /// Begins a write batch.
+        /// @param ring The ring buffer to write to.
+        explicit WriteBatch(RingBufferBase &ring) noexcept;
+
+        WriteBatch(const WriteBatch &) = delete;
+        WriteBatch &operator=(const WriteBatch &) = delete;
+
+        /// Commits any appended data and destroys the batch.
+        ~WriteBatch() noexcept;
+
+        /// Appends data to the batch.
+        /// @param ptr An address containing the data to copy.
+        /// @param size The number of bytes to append.
+        /// @return true if the data was appended, false if insufficient free space is available.
+        bool append(const void *const RB_NONNULL ptr, SizeType size) noexcept [[clang::nonblocking]];
+
+        /// Appends items to the batch.
+        /// @tparam T The type to append.
+        /// @param data A span containing the items to copy.
+        /// @return true if all items were appended, false if insufficient free space is available.
+        template <ByteCopyable T> bool append(std::span<const T> data) noexcept [[clang::nonblocking]];
+
+        /// Appends a value to the batch.
+        /// @param value The value to append.
+        /// @return true if the value was appended, false if insufficient free space is available.
+        bool append(ValueLike auto const &value) noexcept [[clang::nonblocking]];
+
+        /// Returns the number of bytes appended since the batch began or was last committed.
+        [[nodiscard]] SizeType size() const noexcept [[clang::nonblocking]];
+
+        /// Makes all appended data visible to the consumer.
+        void commit() noexcept [[clang::nonblocking]];
+
+        /// Discards all data appended since the batch began or was last committed.
+        void cancel() noexcept [[clang::nonblocking]];
+
+      private:
+        /// The ring buffer being written.
+        RingBufferBase &ring_;
+        /// The writable space most recently obtained from the ring buffer.
+        WriteVector vector_{};
+        /// The number of bytes appended but not yet committed.
+        SizeType size_{0};
+
+        /// Appends size bytes, which is at most MaxSize, from src.
+        template <std::size_t MaxSize>
+        bool appendUpTo(const unsigned char *const RB_NONNULL src, SizeType size) noexcept [[clang::nonblocking]];
+    };
 
-template <ValueLike... Args>
-    requires(sizeof...(Args) > 1)
-inline bool RingBuffer::writeAll(const Args &...args) noexcept {
-    constexpr auto totalSize = (sizeof args + ...);
-    auto [front, back] = writeVector();
-    const auto frontSize = front.size();
+    /// A sequence of reads released to the producer with a single store to the read position.
+    ///
+    /// Data read from a batch is consumed immediately but the space it occupied is not returned to the producer until
+    /// the batch is committed, either explicitly or when the batch is destroyed.
+    /// @note This class is only safe to use from the consumer, and only one batch may be active at a time.
+    class ReadBatch {
+      public:
+        /// Begins a read batch.
+        /// @param ring The ring buffer to read from.
+        explicit ReadBatch(RingBufferBase &ring) noexcept;
+
+        ReadBatch(const ReadBatch &) = delete;
+        ReadBatch &operator=(const ReadBatch &) = delete;
+
+        /// Commits any consumed data and destroys the batch.
+        ~ReadBatch() noexcept;
+
+        /// Reads data from the batch.
+        /// @param ptr An address to receive the data.
+        /// @param size The number of bytes to read.
+        /// @return true if the data was read, false if insufficient data is available.
+        bool read(void *const RB_NONNULL ptr, SizeType size) noexcept [[clang::nonblocking]];
+
+        /// Reads items from the batch.
+        /// @tparam T The type to read.
+        /// @param buffer A span to receive the items.
+        /// @return true if all items were read, false if insufficient data is available.
+        template <ByteCopyable T> bool read(std::span<T> buffer) noexcept [[clang::nonblocking]];
+
+        /// Reads a value from the batch.
+        /// @param value The destination value.
+        /// @return true if the value was read, false if insufficient data is available.
+        bool read(ValueLike auto &value) noexcept [[clang::nonblocking]];
+
+        /// Reads data from the batch without consuming it.
+        /// @param ptr An address to receive the data.
+        /// @param size The number of bytes to read.
+        /// @return true if the data was read, false if insufficient data is available.
+        [[nodiscard]] bool peek(void *const RB_NONNULL ptr, SizeType size) const noexcept [[clang::nonblocking]];
+
+        /// Reads a value from the batch without consuming it.
+        /// @param value The destination value.
+        /// @return true if the value was read, false if insufficient data is available.
+        [[nodiscard]] bool peek(ValueLike auto &value) const noexcept [[clang::nonblocking]];
+
+        /// Skips data in the batch.
+        /// @param size The number of bytes to skip.
+        /// @return true if the data was skipped, false if insufficient data is available.
+        bool skip(SizeType size) noexcept [[clang::nonblocking]];
+
+        /// Blocks until at least count bytes beyond those consumed are available.
+        ///
+        /// If the batch must block any consumed data is committed first so that a producer waiting for free space can
+        /// make progress.
+        /// @tparam W The wait strategy type.
+        /// @param count The number of bytes required.
+        /// @param strategy The wait strategy used while insufficient data is available.
+        /// @return true if at least count bytes are available, false if they can never fit in the ring buffer.
+        template <typename W = ParkWait>
+            requires WaitStrategy<std::remove_cvref_t<W>>
+        bool wait(SizeType count, W &&strategy = {}) noexcept [[clang::blocking]];
+
+        /// Returns the number of bytes consumed since the batch began or was last committed.
+        [[nodiscard]] SizeType size() const noexcept [[clang::nonblocking]];
+
+        /// Returns the space occupied by all consumed data to the producer.
+        void commit() noexcept [[clang::nonblocking]];
+
+        /// Restores all data consumed since the batch began or was last committed.
+        void cancel() noexcept [[clang::nonblocking]];
+
+      private:
+        /// The ring buffer being read.
+        RingBufferBase &ring_;
+        /// The readable data most recently obtained from the ring buffer.
+        mutable ReadVector vector_{};
+        /// The number of bytes consumed but not yet committed.
+        SizeType size_{0};
+
+        /// Ensures the read vector holds at least count bytes beyond those consumed.
+        [[nodiscard]] bool reserve(SizeType count) const noexcept [[clang::nonblocking]];
+
+        /// Copies count bytes following those consumed to ptr.
+        void copy(void *const RB_NONNULL ptr, SizeType count) const noexcept [[clang::nonblocking]];
+    };
 
-    if (frontSize + back.size() < totalSize) {
-        return false;
-    }
+  protected:
+    RingBufferBase() noexcept = default;
+    ~RingBufferBase() noexcept = default;
 
-    std::size_t cursor = 0;
-    const auto writeArg = [&](const void *arg, std::size_t len) noexcept {
-        const auto *src = static_cast<const unsigned char *>(arg);
-        if (cursor + len <= frontSize) {
-            std::memcpy(front.data() + cursor, src, len);
-        } else if (cursor >= frontSize) {
-            std::memcpy(back.data() + (cursor - frontSize), src, len);
-        } else [[unlikely]] {
-            const std::size_t toFront = frontSize - cursor;
-            std::memcpy(front.data() + cursor, src, toFront);
-            std::memcpy(back.data(), src + toFront, len - toFront);
-        }
-        cursor += len;
-    };
+    RingBufferBase(const RingBufferBase &) = delete;
+    RingBufferBase &operator=(const RingBufferBase &) = delete;
 
-    (writeArg(std::addressof(args), sizeof args), ...);
+    /// Resets the read and write positions to zero.
+    /// @note This method is not thread safe.
+    void resetPositions() noexcept;
 
-    commitWrite(totalSize);
-    return true;
-}
+    /// Moves the read and write positions from another ring buffer and resets those of other to zero.
+    /// @note This method is not thread safe.
+    void movePositions(RingBufferBase &other) noexcept;
 
-// MARK: Reading
+  private:
+    friend class RingSet;
 
-inline auto RingBuffer::read(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
-                             bool allowPartial) noexcept -> SizeType {
-    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity_ == 0) [[unlikely]] {
-        return 0;
-    }
+    /// The free-running write location.
+    alignas(cacheLineSize) AtomicSizeType writePosition_{0};
+    /// The producer's most recently observed read location.
+    mutable SizeType cachedReadPosition_{0};
+    /// The producer's usage counters.
+    [[no_unique_address]] mutable typename Statistics::Producer producerStatistics_{};
 
-    const auto writePos = writePosition_.load(std::memory_order_acquire);
-    const auto readPos = readPosition_.load(std::memory_order_relaxed);
-    const auto bytesUsed = writePos - readPos;
-    const auto itemsAvailable = bytesUsed / itemSize;
+    /// The free-running read location.
+    alignas(cacheLineSize) AtomicSizeType readPosition_{0};
+    /// The consumer's most recently observed write location.
+    mutable SizeType cachedWritePosition_{0};
+    /// The consumer's usage counters.
+    [[no_unique_address]] mutable typename Statistics::Consumer consumerStatistics_{};
+
+    /// Nonzero while the consumer is blocked waiting for data.
+    alignas(cacheLineSize) std::atomic<std::uint32_t> dataWaiter_{0};
+    /// Nonzero while the producer is blocked waiting for free space.
+    std::atomic<std::uint32_t> spaceWaiter_{0};
+    /// The consumer coroutine suspended waiting for data, if any.
+    std::atomic<detail::Continuation *> dataAwaiter_{nullptr};
+    /// The producer coroutine suspended waiting for free space, if any.
+    std::atomic<detail::Continuation *> spaceAwaiter_{nullptr};
+
+    /// Reloads the producer's copy of the read position and records the occupancy it reveals.
+    /// @note This method is only safe to call from the producer.
+    void reloadReadPosition(SizeType writePos) const noexcept [[clang::nonblocking]];
 
-    if (itemsAvailable == 0 || (itemsAvailable < itemCount && !allowPartial)) {
-        return 0;
-    }
+    /// Reloads the consumer's copy of the write position and records the occupancy it reveals.
+    /// @note This method is only safe to call from the consumer.
+    void reloadWritePosition(SizeType readPos) const noexcept [[clang::nonblocking]];
 
-    const auto itemsToRead = std::min(itemsAvailable, itemCount);
-    const auto bytesToRead = itemsToRead * itemSize;
-    auto *dst = static_cast<unsigned char *>(ptr);
-    const auto *src = static_cast<const unsigned char *>(buffer_);
-    const auto readIndex = readPos & capacityMask_;
-    const auto bytesToEnd = capacity_ - readIndex;
+    /// Returns true if count bytes written or read at the free-running position pos cross the end of the buffer.
+    [[nodiscard]] bool crossesEnd(SizeType pos, SizeType count) const noexcept [[clang::nonblocking]];
 
-    if (bytesToRead <= bytesToEnd) [[likely]] {
-        std::memcpy(dst, src + readIndex, bytesToRead);
-    } else [[unlikely]] {
-        std::memcpy(dst, src + readIndex, bytesToEnd);
-        std::memcpy(dst + bytesToEnd, src, bytesToRead - bytesToEnd);
-    }
+    /// Returns the number of bytes that may be written, reloading the read position only if the cached read position
+    /// indicates that fewer than count bytes are free.
+    /// @note This method is only safe to call from the producer.
+    [[nodiscard]] SizeType writableBytes(SizeType writePos, SizeType count) const noexcept [[clang::nonblocking]];
 
-    readPosition_.store(readPos + bytesToRead, std::memory_order_release);
-    return itemsToRead;
-}
+    /// Returns the number of bytes that may be read, reloading the write position only if the cached write position
+    /// indicates that fewer than count bytes are available.
+    /// @note This method is only safe to call from the consumer.
+    [[nodiscard]] SizeType readableBytes(SizeType readPos, SizeType count) const noexcept [[clang::nonblocking]];
 
-template <ByteCopyable T> inline auto RingBuffer::read(std::span<T> buffer, bool allowPartial) noexcept -> SizeType {
-    return read(buffer.data(), sizeof(T), buffer.size(), allowPartial);
-}
+    /// Writes Size bytes from src if they fit, with every copy specialized for the size.
+    /// @note This method is only safe to call from the producer.
+    template <std::size_t Size>
+    bool writeFixed(const unsigned char *const RB_NONNULL src) noexcept [[clang::nonblocking]];
 
-inline bool RingBuffer::read(ValueLike auto &value) noexcept {
-    return read(std::addressof(value), sizeof value, 1, false) == 1;
-}
+    /// Copies Size bytes at readPos to dst if they are available, with every copy specialized for the size.
+    /// @note This method is only safe to call from the consumer.
+    template <std::size_t Size>
+    bool peekFixed(SizeType readPos, unsigned char *const RB_NONNULL dst) const noexcept [[clang::nonblocking]];
 
-template <ValueLike T>
-    requires std::default_initializable<T>
-inline auto RingBuffer::read() noexcept(std::is_nothrow_default_constructible_v<T>) -> std::optional<T> {
-    if (std::optional<T> result; read(result.emplace())) {
-        return result;
-    }
-    return std::nullopt;
-}
+    /// Reads Size bytes into dst if they are available, with every copy specialized for the size.
+    /// @note This method is only safe to call from the consumer.
+    template <std::size_t Size> bool readFixed(unsigned char *const RB_NONNULL dst) noexcept [[clang::nonblocking]];
 
-template <ValueLike... Args>
-    requires(sizeof...(Args) > 1) && (std::assignable_from<Args &, const Args &> && ...)
-inline bool RingBuffer::readAll(Args &...args) noexcept {
-    if (!peekAll(args...)) {
+    /// Blocks the producer until at least count bytes are free or deadline passes.
+    /// @note This method is only safe to call from the producer.
+    /// @param count The number of bytes of free space required.
+    /// @param deadline The time at which to stop waiting or nullptr to wait indefinitely.
+    /// @param strategy The wait strategy used while insufficient space is free.
+    /// @return true if at least count bytes are free.
+    template <WaitStrategy W>
+    bool waitForSpace(SizeType count, const std::chrono::steady_clock::time_point *RB_NULLABLE deadline,
+                      W &strategy) noexcept [[clang::blocking]];
+
+    /// Blocks the consumer until at least count bytes are available or deadline passes.
+    /// @note This method is only safe to call from the consumer.
+    /// @param count The number of bytes of data required.
+    /// @param deadline The time at which to stop waiting or nullptr to wait indefinitely.
+    /// @param strategy The wait strategy used while insufficient data is available.
+    /// @return true if at least count bytes are available.
+    template <WaitStrategy W>
+    bool waitForData(SizeType count, const std::chrono::steady_clock::time_point *RB_NULLABLE deadline,
+                     W &strategy) noexcept [[clang::blocking]];
+
+    /// Blocks until reload returns at least count or deadline passes, parking on waiter when the strategy says so.
+    template <WaitStrategy W, typename Reload>
+    static bool waitUntilReady(std::atomic<std::uint32_t> &waiter, Reload &&reload, SizeType count,
+                               const std::chrono::steady_clock::time_point *RB_NULLABLE deadline,
+                               W &strategy) noexcept [[clang::blocking]];
+
+    /// Returns true if at least count bytes of data, or of free space if Space is true, are available.
+    ///
+    /// Only the positions are read, so this method may be called from either side.
+    template <bool Space> [[nodiscard]] bool isReady(SizeType count) const noexcept [[clang::nonblocking]];
+
+    /// Publishes a coroutine waiting for data, or for free space if Space is true.
+    /// @return true if the coroutine should remain suspended, false if the condition held once it was published.
+    template <bool Space> bool suspend(detail::Continuation &continuation) noexcept [[clang::nonblocking]];
+
+    /// Removes a published continuation from slot, waiting while the other side examines it.
+    /// @return true if the continuation was removed, false if it is no longer published.
+    static bool withdraw(std::atomic<detail::Continuation *> &slot,
+                         detail::Continuation *const RB_NONNULL continuation) noexcept [[clang::nonblocking]];
+
+    /// Resumes the coroutine waiting for data, or for free space if Space is true, if its condition holds.
+    template <bool Space> void resumeAwaiter() noexcept;
+
+    /// Returns the memory buffer holding the data.
+    [[nodiscard]] unsigned char *RB_NULLABLE storage() const noexcept [[clang::nonblocking]];
+
+    /// Returns the capacity of the memory buffer in bytes minus one.
+    [[nodiscard]] SizeType capacityMask() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of bytes addressable contiguously from the start of the memory buffer.
+    [[nodiscard]] SizeType extent() const noexcept [[clang::nonblocking]];
+
+    /// Calls f with each nonempty region while it processes all of the previous one and returns the total processed.
+    template <typename T, typename F>
+    static SizeType processRegions(std::pair<std::span<T>, std::span<T>> regions, F &f) noexcept(
+            std::is_nothrow_invocable_v<F &, std::span<T>>);
+
+    /// Returns true if the memory following the free-running position pos may be divided into whole, aligned
+    /// elements of type T.
+    template <typename T> [[nodiscard]] bool isElementBoundary(SizeType pos) const noexcept [[clang::nonblocking]];
+
+    static_assert(AtomicSizeType::is_always_lock_free, "Lock-free AtomicSizeType required");
+};
+
+// MARK: - Allocation Options
+
+/// How huge pages are used to back a ring buffer.
+enum class HugePages : std::uint8_t {
+    /// The buffer uses the system's default page size.
+    none,
+    /// The buffer is aligned to the huge page size and the system is advised to back it with huge pages.
+    ///
+    /// This uses `madvise(MADV_HUGEPAGE)` on Linux and is ignored elsewhere.
+    transparent,
+    /// The buffer must be backed by huge pages reserved for that purpose.
+    ///
+    /// This uses `MAP_HUGETLB` on Linux and `MEM_LARGE_PAGES` on Windows, and is unavailable elsewhere.
+    required,
+};
+
+/// Options controlling how space for the data of a ring buffer is allocated.
+///
+/// If ``hugePages``, ``numaNode``, or ``locked`` is set for a buffer that is not mirrored, the buffer is mapped
+/// directly from the system and its capacity is rounded up to the page size, or to the huge page size if huge pages
+/// are used.
+struct AllocationOptions {
+    /// Whether the buffer's pages should be mapped twice in adjacent virtual memory.
+    ///
+    /// In a mirrored buffer every readable and writable region is contiguous, so the second span of a read or
+    /// write vector is always empty and copies never need to be split at the end of the buffer.
+    /// @note The capacity of a mirrored buffer is rounded up to the system's virtual memory allocation
+    /// granularity, and mirroring is only available on Linux, Darwin, and Windows.
+    bool mirrored{false};
+
+    /// How huge pages are used to back the buffer.
+    /// @note Huge pages may not be combined with ``mirrored``.
+    HugePages hugePages{HugePages::none};
+
+    /// The NUMA node on which the buffer's memory is placed, or -1 for the system's default placement.
+    ///
+    /// Binding a buffer to the node of the thread that touches it most, typically the consumer, avoids remote
+    /// memory accesses on multi-socket systems.
+    /// @note NUMA binding is available on Linux and, for buffers that are not mirrored, on Windows.
+    int numaNode{-1};
+
+    /// Whether the buffer's pages should be locked in physical memory so they are never paged out.
+    /// @note Locking may fail if it would exceed the process's locked memory limit.
+    bool locked{false};
+
+    /// Whether every page of the buffer should be touched during allocation.
+    ///
+    /// Prefaulting moves the cost of the first page faults out of the read and write paths, which matters when
+    /// the first pass through the buffer happens on a real-time thread.
+    bool prefault{false};
+};
+
+namespace detail {
+
+/// The memory holding the data of a ``BasicRingBuffer``.
+///
+/// Allocation does not depend on the statistics policy, so it is implemented once for every ``BasicRingBuffer``.
+class RingStorage final {
+  public:
+    RingStorage() noexcept = default;
+
+    RingStorage(const RingStorage &) = delete;
+    RingStorage &operator=(const RingStorage &) = delete;
+
+    RingStorage(RingStorage &&other) noexcept;
+    RingStorage &operator=(RingStorage &&other) noexcept;
+
+    ~RingStorage() noexcept;
+
+    /// Allocates at least minCapacity bytes, which must be in range, without releasing any existing allocation.
+    bool allocate(std::size_t minCapacity, const AllocationOptions &options) noexcept [[clang::allocating]];
+    /// Allocates at least minCapacity bytes from resource, which must be in range, without releasing any existing
+    /// allocation.
+    bool allocate(std::size_t minCapacity, std::pmr::memory_resource &resource) noexcept [[clang::allocating]];
+    /// Uses region, whose size must be a supported power of two, without releasing any existing allocation.
+    void adopt(std::span<unsigned char> region) noexcept [[clang::nonblocking]];
+    /// Frees any allocation, returning true if there was one.
+    bool deallocate() noexcept;
+
+    [[nodiscard]] unsigned char *RB_NULLABLE data() const noexcept [[clang::nonblocking]] {
+        return static_cast<unsigned char *>(buffer_);
+    }
+    [[nodiscard]] std::size_t capacity() const noexcept [[clang::nonblocking]] { return capacity_; }
+    [[nodiscard]] std::size_t mask() const noexcept [[clang::nonblocking]] { return capacityMask_; }
+    [[nodiscard]] std::size_t extent() const noexcept [[clang::nonblocking]] { return extent_; }
+
+  private:
+    /// The memory buffer holding the data.
+    void *RB_NULLABLE buffer_{nullptr};
+
+    /// The capacity of buffer_ in bytes.
+    std::size_t capacity_{0};
+    /// The capacity of buffer_ in bytes minus one.
+    std::size_t capacityMask_{0};
+    /// The number of bytes addressable contiguously from buffer_: capacity_, or twice capacity_ if mirrored.
+    std::size_t extent_{0};
+
+    /// How buffer_ was obtained.
+    enum class Backing : std::uint8_t {
+        /// From std::malloc.
+        heap,
+        /// Mapped directly from the system.
+        mapped,
+        /// Mapped twice in adjacent virtual memory.
+        mirrored,
+        /// From resource_.
+        resource,
+        /// Owned by the caller.
+        adopted,
+    };
+
+    /// How buffer_ was obtained.
+    Backing backing_{Backing::heap};
+    /// The memory resource buffer_ was allocated from if backing_ is Backing::resource.
+    std::pmr::memory_resource *RB_NULLABLE resource_{nullptr};
+};
+
+} /* namespace detail */
+
+template <typename Statistics = NoStatistics> class BasicRingBuffer;
+
+template <typename S> struct RingBufferTraits<BasicRingBuffer<S>> {
+    using Statistics = S;
+};
+
+/// A lock-free SPSC ring buffer.
+///
+/// This class is thread safe when used with a single producer and a single consumer.
+///
+/// This ring buffer performs raw byte copies; it does not provide serialization.
+/// @tparam Statistics The statistics policy.
+template <typename Statistics> class BasicRingBuffer final : public RingBufferBase<BasicRingBuffer<Statistics>> {
+    using Base = RingBufferBase<BasicRingBuffer<Statistics>>;
+
+  public:
+    using typename Base::SizeType;
+
+    /// How huge pages are used to back the buffer.
+    using HugePages = spsc::HugePages;
+    /// Options controlling how space for data is allocated.
+    using AllocationOptions = spsc::AllocationOptions;
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty ring buffer.
+    /// @note ``allocate`` must be called before the object may be used.
+    BasicRingBuffer() noexcept = default;
+
+    /// Creates a ring buffer with the specified minimum capacity.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
+    /// supported.
+    explicit BasicRingBuffer(SizeType minCapacity);
+
+    /// Creates a ring buffer with the specified minimum capacity and allocation options.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity and satisfies any constraints imposed by the allocation options.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param options The allocation options.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
+    /// supported.
+    BasicRingBuffer(SizeType minCapacity, const AllocationOptions &options);
+
+    /// Creates a ring buffer with the specified minimum capacity using memory from a memory resource.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param resource The memory resource from which to allocate. It must outlive the allocation.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
+    /// supported.
+    BasicRingBuffer(SizeType minCapacity, std::pmr::memory_resource &resource);
+
+    /// Creates a ring buffer using memory owned by the caller.
+    /// @param region The memory to use for data. Its size must be a supported integral power of two and it must
+    /// outlive the ring buffer's use of it.
+    /// @throw std::invalid_argument if the size of region is not supported.
+    explicit BasicRingBuffer(std::span<unsigned char> region);
+
+    BasicRingBuffer(const BasicRingBuffer &) = delete;
+    BasicRingBuffer &operator=(const BasicRingBuffer &) = delete;
+
+    /// Creates a ring buffer by moving the contents of another ring buffer.
+    /// @note This method is not thread safe for the ring buffer being moved.
+    /// @param other The ring buffer to move.
+    BasicRingBuffer(BasicRingBuffer &&other) noexcept;
+
+    /// Moves the contents of another ring buffer into this ring buffer.
+    /// @note This method is not thread safe.
+    /// @param other The ring buffer to move.
+    BasicRingBuffer &operator=(BasicRingBuffer &&other) noexcept;
+
+    /// Destroys the ring buffer and releases all associated resources.
+    ~BasicRingBuffer() noexcept = default;
+
+    // MARK: Buffer Management
+
+    /// Allocates space for data.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @note This method is not thread safe.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @return true on success, false if memory could not be allocated or the buffer capacity is not supported.
+    bool allocate(SizeType minCapacity) noexcept [[clang::allocating]];
+
+    /// Allocates space for data using the specified allocation options.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity and satisfies any constraints imposed by the allocation options.
+    /// @note This method is not thread safe.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param options The allocation options.
+    /// @return true on success, false if memory could not be allocated, the buffer capacity is not supported, or the
+    /// options are not supported on this platform.
+    bool allocate(SizeType minCapacity, const AllocationOptions &options) noexcept [[clang::allocating]];
+
+    /// Allocates space for data from a memory resource.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity. The memory is aligned to ``cacheLineSize`` and returned to resource by ``deallocate()``.
+    /// @note This method is not thread safe.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param resource The memory resource from which to allocate. It must outlive the allocation.
+    /// @return true on success, false if memory could not be allocated or the buffer capacity is not supported.
+    bool allocate(SizeType minCapacity, std::pmr::memory_resource &resource) noexcept [[clang::allocating]];
+
+    /// Uses memory owned by the caller for data.
+    ///
+    /// The ring buffer does not free region. Data written to region by the caller before adopting it is discarded;
+    /// use ``commitWrite()`` to publish data placed in the region directly.
+    /// @note This method is not thread safe.
+    /// @param region The memory to use for data. Its size must be a supported integral power of two and it must
+    /// outlive the ring buffer's use of it.
+    /// @return true on success, false if the size of region is not supported.
+    bool adopt(std::span<unsigned char> region) noexcept [[clang::nonblocking]];
+
+    /// Frees any space allocated for data.
+    /// @note This method is not thread safe.
+    void deallocate() noexcept;
+
+  private:
+    friend Base;
+
+    // The buffer geometry is read-only once allocated and is kept apart from the positions.
+
+    /// The memory holding the data.
+    alignas(cacheLineSize) detail::RingStorage storage_;
+
+    [[nodiscard]] unsigned char *RB_NULLABLE storageData() const noexcept [[clang::nonblocking]];
+    [[nodiscard]] SizeType storageCapacity() const noexcept [[clang::nonblocking]];
+    [[nodiscard]] SizeType storageMask() const noexcept [[clang::nonblocking]];
+    [[nodiscard]] SizeType storageExtent() const noexcept [[clang::nonblocking]];
+};
+
+/// A lock-free SPSC ring buffer without statistics.
+using RingBuffer = BasicRingBuffer<>;
+
+template <std::size_t Capacity, typename Statistics = NoStatistics> class StaticRingBuffer;
+
+template <std::size_t Capacity, typename S> struct RingBufferTraits<StaticRingBuffer<Capacity, S>> {
+    using Statistics = S;
+};
+
+/// A lock-free SPSC ring buffer with a fixed capacity and inline storage.
+///
+/// This class is thread safe when used with a single producer and a single consumer.
+///
+/// This ring buffer performs raw byte copies; it does not provide serialization. Because the capacity is a compile-time
+/// constant no allocation is performed and all index masking folds to constants.
+/// @tparam Capacity The capacity of the ring buffer in bytes, an integral power of two.
+/// @tparam Statistics The statistics policy.
+template <std::size_t Capacity, typename Statistics>
+class StaticRingBuffer final : public RingBufferBase<StaticRingBuffer<Capacity, Statistics>> {
+    using Base = RingBufferBase<StaticRingBuffer<Capacity, Statistics>>;
+
+  public:
+    static_assert(Capacity >= Base::minCapacity && Capacity <= Base::maxCapacity, "Capacity out of range");
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty ring buffer.
+    StaticRingBuffer() noexcept = default;
+
+    StaticRingBuffer(const StaticRingBuffer &) = delete;
+    StaticRingBuffer &operator=(const StaticRingBuffer &) = delete;
+
+    /// Destroys the ring buffer.
+    ~StaticRingBuffer() noexcept = default;
+
+  private:
+    friend Base;
+
+    /// The memory buffer holding the data.
+    alignas(cacheLineSize) std::array<unsigned char, Capacity> buffer_;
+
+    [[nodiscard]] unsigned char *storageData() const noexcept [[clang::nonblocking]];
+    [[nodiscard]] static constexpr std::size_t storageCapacity() noexcept [[clang::nonblocking]];
+    [[nodiscard]] static constexpr std::size_t storageMask() noexcept [[clang::nonblocking]];
+    [[nodiscard]] static constexpr std::size_t storageExtent() noexcept [[clang::nonblocking]];
+};
+
+// MARK: - Implementation -
+
+// MARK: Buffer Information
+
+template <typename Derived> inline RingBufferBase<Derived>::operator bool() const noexcept {
+    return storage() != nullptr;
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::capacity() const noexcept -> SizeType {
+    return static_cast<const Derived &>(*this).storageCapacity();
+}
+
+template <typename Derived> inline bool RingBufferBase<Derived>::isMirrored() const noexcept {
+    return extent() > capacity();
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::writePosition() const noexcept -> SizeType {
+    return writePosition_.load(std::memory_order_relaxed);
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::readPosition() const noexcept -> SizeType {
+    return readPosition_.load(std::memory_order_relaxed);
+}
+
+// MARK: Buffer Usage
+
+template <typename Derived> inline auto RingBufferBase<Derived>::freeSpace() const noexcept -> SizeType {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto readPos = readPosition_.load(std::memory_order_acquire);
+    return capacity() - (writePos - readPos);
+}
+
+template <typename Derived> inline bool RingBufferBase<Derived>::isFull() const noexcept {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto readPos = readPosition_.load(std::memory_order_acquire);
+    return (writePos - readPos) == capacity();
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::availableBytes() const noexcept -> SizeType {
+    const auto writePos = writePosition_.load(std::memory_order_acquire);
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    return writePos - readPos;
+}
+
+template <typename Derived> inline bool RingBufferBase<Derived>::isEmpty() const noexcept {
+    const auto writePos = writePosition_.load(std::memory_order_acquire);
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    return writePos == readPos;
+}
+
+// MARK: Statistics
+
+template <typename Derived>
+inline RingBufferStatistics RingBufferBase<Derived>::statistics() const noexcept
+    requires(!std::is_same_v<Statistics, NoStatistics>)
+{
+    RingBufferStatistics snapshot;
+    producerStatistics_.collect(snapshot);
+    consumerStatistics_.collect(snapshot);
+    return snapshot;
+}
+
+// MARK: Writing
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                           bool allowPartial, CopyMode mode) noexcept -> SizeType {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity() == 0) [[unlikely]] {
+        return 0;
+    }
+
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    auto itemsFree = (capacity() - (writePos - cachedReadPosition_)) / itemSize;
+
+    if (itemsFree < itemCount) {
+        reloadReadPosition(writePos);
+        itemsFree = (capacity() - (writePos - cachedReadPosition_)) / itemSize;
+    }
+
+    if (itemsFree == 0 || (itemsFree < itemCount && !allowPartial)) {
+        producerStatistics_.recordFull();
+        return 0;
+    }
+
+    const auto itemsToWrite = std::min(itemsFree, itemCount);
+    const auto bytesToWrite = itemsToWrite * itemSize;
+    auto *dst = storage();
+    const auto *src = static_cast<const unsigned char *>(ptr);
+    const auto writeIndex = writePos & capacityMask();
+    const auto bytesToEnd = extent() - writeIndex;
+
+    if (bytesToWrite <= bytesToEnd) [[likely]] {
+        detail::copy(dst + writeIndex, src, bytesToWrite, mode);
+    } else [[unlikely]] {
+        detail::copy(dst + writeIndex, src, bytesToEnd, mode);
+        detail::copy(dst, src + bytesToEnd, bytesToWrite - bytesToEnd, mode);
+    }
+
+    // Non-temporal stores are weakly ordered and must complete before the release store publishes them
+    if (mode == CopyMode::streaming) {
+        detail::streamingFence();
+    }
+
+    producerStatistics_.recordWrite(writePos, bytesToWrite, crossesEnd(writePos, bytesToWrite));
+    writePosition_.store(writePos + bytesToWrite, std::memory_order_release);
+
+    if (itemsToWrite < itemCount) {
+        producerStatistics_.recordFull();
+    }
+    return itemsToWrite;
+}
+
+template <typename Derived>
+template <ByteCopyable T>
+inline auto RingBufferBase<Derived>::write(std::span<const T> data, bool allowPartial, CopyMode mode) noexcept
+        -> SizeType {
+    return write(data.data(), sizeof(T), data.size(), allowPartial, mode);
+}
+
+template <typename Derived> inline bool RingBufferBase<Derived>::write(ValueLike auto const &value) noexcept {
+    return writeFixed<sizeof value>(reinterpret_cast<const unsigned char *>(std::addressof(value)));
+}
+
+template <typename Derived>
+template <ValueLike... Args>
+    requires(sizeof...(Args) > 1)
+inline bool RingBufferBase<Derived>::writeAll(const Args &...args) noexcept {
+    constexpr auto totalSize = (sizeof args + ...);
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    if (writableBytes(writePos, totalSize) < totalSize) {
+        producerStatistics_.recordFull();
+        return false;
+    }
+
+    auto *dst = storage();
+    const auto writeIndex = writePos & capacityMask();
+    const auto frontSize = extent() - writeIndex;
+    std::size_t cursor = 0;
+
+    if (totalSize <= frontSize) [[likely]] {
+        // Every offset is a constant, so each value is copied with a store of its size
+        ((std::memcpy(dst + writeIndex + cursor, std::addressof(args), sizeof args), cursor += sizeof args), ...);
+    } else [[unlikely]] {
+        const auto writeArg = [&](const void *arg, std::size_t len) noexcept {
+            const auto *src = static_cast<const unsigned char *>(arg);
+            if (cursor + len <= frontSize) {
+                std::memcpy(dst + writeIndex + cursor, src, len);
+            } else if (cursor >= frontSize) {
+                std::memcpy(dst + (cursor - frontSize), src, len);
+            } else {
+                const std::size_t toFront = frontSize - cursor;
+                std::memcpy(dst + writeIndex + cursor, src, toFront);
+                std::memcpy(dst, src + toFront, len - toFront);
+            }
+            cursor += len;
+        };
+
+        (writeArg(std::addressof(args), sizeof args), ...);
+    }
+
+    producerStatistics_.recordWrite(writePos, totalSize, crossesEnd(writePos, totalSize));
+    writePosition_.store(writePos + totalSize, std::memory_order_release);
+    return true;
+}
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::writev(std::span<const std::span<const std::byte>> fragments,
+                                            bool allowPartial) noexcept -> SizeType {
+    SizeType totalSize = 0;
+    for (const auto &fragment : fragments) {
+        totalSize += fragment.size();
+    }
+
+    if (totalSize == 0 || capacity() == 0) [[unlikely]] {
+        return 0;
+    }
+
+    auto [front, back] = writeVector(totalSize);
+    const auto bytesToWrite = std::min(front.size() + back.size(), totalSize);
+
+    if (bytesToWrite < totalSize) {
+        producerStatistics_.recordFull();
+    }
+    if (bytesToWrite == 0 || (bytesToWrite < totalSize && !allowPartial)) {
+        return 0;
+    }
+
+    SizeType cursor = 0;
+    for (const auto &fragment : fragments) {
+        const auto *src = reinterpret_cast<const unsigned char *>(fragment.data());
+        auto len = std::min(fragment.size(), bytesToWrite - cursor);
+        if (len == 0) {
+            continue;
+        }
+        if (cursor < front.size()) {
+            const auto toFront = std::min(len, front.size() - cursor);
+            std::memcpy(front.data() + cursor, src, toFront);
+            src += toFront;
+            len -= toFront;
+            cursor += toFront;
+        }
+        if (len > 0) {
+            std::memcpy(back.data() + (cursor - front.size()), src, len);
+            cursor += len;
+        }
+    }
+
+    commitWrite(bytesToWrite);
+    return bytesToWrite;
+}
+
+// MARK: Reading
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::read(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                          bool allowPartial, CopyMode mode) noexcept -> SizeType {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity() == 0) [[unlikely]] {
+        return 0;
+    }
+
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    auto itemsAvailable = (cachedWritePosition_ - readPos) / itemSize;
+
+    if (itemsAvailable < itemCount) {
+        reloadWritePosition(readPos);
+        itemsAvailable = (cachedWritePosition_ - readPos) / itemSize;
+    }
+
+    if (itemsAvailable == 0 || (itemsAvailable < itemCount && !allowPartial)) {
+        consumerStatistics_.recordEmpty();
+        return 0;
+    }
+
+    const auto itemsToRead = std::min(itemsAvailable, itemCount);
+    const auto bytesToRead = itemsToRead * itemSize;
+    auto *dst = static_cast<unsigned char *>(ptr);
+    const auto *src = storage();
+    const auto readIndex = readPos & capacityMask();
+    const auto bytesToEnd = extent() - readIndex;
+
+    if (bytesToRead <= bytesToEnd) [[likely]] {
+        detail::copy(dst, src + readIndex, bytesToRead, mode);
+    } else [[unlikely]] {
+        detail::copy(dst, src + readIndex, bytesToEnd, mode);
+        detail::copy(dst + bytesToEnd, src, bytesToRead - bytesToEnd, mode);
+    }
+
+    if (mode == CopyMode::streaming) {
+        detail::streamingFence();
+    }
+
+    readPosition_.store(readPos + bytesToRead, std::memory_order_release);
+
+    consumerStatistics_.recordRead(readPos, bytesToRead, producerStatistics_);
+    if (itemsToRead < itemCount) {
+        consumerStatistics_.recordEmpty();
+    }
+    return itemsToRead;
+}
+
+template <typename Derived>
+template <ByteCopyable T>
+inline auto RingBufferBase<Derived>::read(std::span<T> buffer, bool allowPartial, CopyMode mode) noexcept -> SizeType {
+    return read(buffer.data(), sizeof(T), buffer.size(), allowPartial, mode);
+}
+
+template <typename Derived> inline bool RingBufferBase<Derived>::read(ValueLike auto &value) noexcept {
+    return readFixed<sizeof value>(reinterpret_cast<unsigned char *>(std::addressof(value)));
+}
+
+template <typename Derived>
+template <ValueLike T>
+    requires std::default_initializable<T>
+inline auto RingBufferBase<Derived>::read() noexcept(std::is_nothrow_default_constructible_v<T>) -> std::optional<T> {
+    if (std::optional<T> result; read(result.emplace())) {
+        return result;
+    }
+    return std::nullopt;
+}
+
+template <typename Derived>
+template <ValueLike... Args>
+    requires(sizeof...(Args) > 1) && (std::assignable_from<Args &, const Args &> && ...)
+inline bool RingBufferBase<Derived>::readAll(Args &...args) noexcept {
+    if (!peekAll(args...)) {
+        consumerStatistics_.recordEmpty();
+        return false;
+    }
+    commitRead((sizeof args + ...));
+    return true;
+}
+
+template <typename Derived>
+template <ValueLike... Args>
+    requires(sizeof...(Args) > 1) && (std::default_initializable<Args> && ...)
+inline auto RingBufferBase<Derived>::readAll() noexcept((std::is_nothrow_default_constructible_v<Args> && ...))
+        -> std::optional<std::tuple<Args...>> {
+    auto result = peekAll<Args...>();
+    if (!result) {
+        consumerStatistics_.recordEmpty();
+        return std::nullopt;
+    }
+    commitRead((sizeof(Args) + ...));
+    return result;
+}
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::readv(std::span<const std::span<std::byte>> buffers, bool allowPartial) noexcept
+        -> SizeType {
+    SizeType totalSize = 0;
+    for (const auto &buffer : buffers) {
+        totalSize += buffer.size();
+    }
+
+    if (totalSize == 0 || capacity() == 0) [[unlikely]] {
+        return 0;
+    }
+
+    auto [front, back] = readVector(totalSize);
+    const auto bytesToRead = std::min(front.size() + back.size(), totalSize);
+
+    if (bytesToRead < totalSize) {
+        consumerStatistics_.recordEmpty();
+    }
+    if (bytesToRead == 0 || (bytesToRead < totalSize && !allowPartial)) {
+        return 0;
+    }
+
+    SizeType cursor = 0;
+    for (const auto &buffer : buffers) {
+        auto *dst = reinterpret_cast<unsigned char *>(buffer.data());
+        auto len = std::min(buffer.size(), bytesToRead - cursor);
+        if (len == 0) {
+            continue;
+        }
+        if (cursor < front.size()) {
+            const auto fromFront = std::min(len, front.size() - cursor);
+            std::memcpy(dst, front.data() + cursor, fromFront);
+            dst += fromFront;
+            len -= fromFront;
+            cursor += fromFront;
+        }
+        if (len > 0) {
+            std::memcpy(dst, back.data() + (cursor - front.size()), len);
+            cursor += len;
+        }
+    }
+
+    commitRead(bytesToRead);
+    return bytesToRead;
+}
+
+// MARK: Peeking
+
+template <typename Derived>
+inline bool RingBufferBase<Derived>::peek(void *const RB_NONNULL ptr, SizeType itemSize,
+                                          SizeType itemCount) const noexcept {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity() == 0) [[unlikely]] {
+        return false;
+    }
+
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    auto itemsAvailable = (cachedWritePosition_ - readPos) / itemSize;
+
+    if (itemsAvailable < itemCount) {
+        reloadWritePosition(readPos);
+        itemsAvailable = (cachedWritePosition_ - readPos) / itemSize;
+    }
+
+    if (itemsAvailable < itemCount) {
+        return false;
+    }
+
+    const auto bytesToPeek = itemCount * itemSize;
+    auto *dst = static_cast<unsigned char *>(ptr);
+    const auto *src = storage();
+    const auto readIndex = readPos & capacityMask();
+    const auto bytesToEnd = extent() - readIndex;
+
+    if (bytesToPeek <= bytesToEnd) [[likely]] {
+        std::memcpy(dst, src + readIndex, bytesToPeek);
+    } else [[unlikely]] {
+        std::memcpy(dst, src + readIndex, bytesToEnd);
+        std::memcpy(dst + bytesToEnd, src, bytesToPeek - bytesToEnd);
+    }
+
+    return true;
+}
+
+template <typename Derived>
+template <ByteCopyable T>
+inline bool RingBufferBase<Derived>::peek(std::span<T> buffer) const noexcept {
+    return peek(buffer.data(), sizeof(T), buffer.size());
+}
+
+template <typename Derived> inline bool RingBufferBase<Derived>::peek(ValueLike auto &value) const noexcept {
+    return peekFixed<sizeof value>(readPosition_.load(std::memory_order_relaxed),
+                                   reinterpret_cast<unsigned char *>(std::addressof(value)));
+}
+
+template <typename Derived>
+template <ValueLike T>
+    requires std::default_initializable<T>
+inline auto RingBufferBase<Derived>::peek() const noexcept(std::is_nothrow_default_constructible_v<T>)
+        -> std::optional<T> {
+    if (std::optional<T> result; peek(result.emplace())) {
+        return result;
+    }
+    return std::nullopt;
+}
+
+template <typename Derived>
+template <ValueLike... Args>
+    requires(sizeof...(Args) > 1) && (std::assignable_from<Args &, const Args &> && ...)
+inline bool RingBufferBase<Derived>::peekAll(Args &...args) const noexcept {
+    constexpr auto totalSize = (sizeof args + ...);
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    if (readableBytes(readPos, totalSize) < totalSize) {
+        return false;
+    }
+
+    const auto *src = storage();
+    const auto readIndex = readPos & capacityMask();
+    const auto frontSize = extent() - readIndex;
+    std::size_t cursor = 0;
+
+    if (totalSize <= frontSize) [[likely]] {
+        ((std::memcpy(std::addressof(args), src + readIndex + cursor, sizeof args), cursor += sizeof args), ...);
+    } else [[unlikely]] {
+        const auto readArg = [&](void *arg, std::size_t len) noexcept {
+            auto *dst = static_cast<unsigned char *>(arg);
+            if (cursor + len <= frontSize) {
+                std::memcpy(dst, src + readIndex + cursor, len);
+            } else if (cursor >= frontSize) {
+                std::memcpy(dst, src + (cursor - frontSize), len);
+            } else {
+                const std::size_t fromFront = frontSize - cursor;
+                std::memcpy(dst, src + readIndex + cursor, fromFront);
+                std::memcpy(dst + fromFront, src, len - fromFront);
+            }
+            cursor += len;
+        };
+
+        (readArg(std::addressof(args), sizeof args), ...);
+    }
+
+    return true;
+}
+
+template <typename Derived>
+template <ValueLike... Args>
+    requires(sizeof...(Args) > 1) && (std::default_initializable<Args> && ...)
+inline auto RingBufferBase<Derived>::peekAll() const noexcept((std::is_nothrow_default_constructible_v<Args> && ...))
+        -> std::optional<std::tuple<Args...>> {
+    if (std::tuple<Args...> result; std::apply([&](Args &...args) noexcept { return peekAll(args...); }, result)) {
+        return result;
+    }
+    return std::nullopt;
+}
+
+// MARK: Discarding Data
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::skip(SizeType itemSize, SizeType itemCount, bool allowPartial) noexcept
+        -> SizeType {
+    if (itemSize == 0 || itemCount == 0 || capacity() == 0) [[unlikely]] {
+        return 0;
+    }
+
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    auto itemsAvailable = (cachedWritePosition_ - readPos) / itemSize;
+
+    if (itemsAvailable < itemCount) {
+        reloadWritePosition(readPos);
+        itemsAvailable = (cachedWritePosition_ - readPos) / itemSize;
+    }
+
+    if (itemsAvailable == 0 || (itemsAvailable < itemCount && !allowPartial)) {
+        return 0;
+    }
+
+    const auto itemsToSkip = std::min(itemsAvailable, itemCount);
+    const auto bytesToSkip = itemsToSkip * itemSize;
+
+    readPosition_.store(readPos + bytesToSkip, std::memory_order_release);
+    consumerStatistics_.recordRead(readPos, bytesToSkip, producerStatistics_);
+    return itemsToSkip;
+}
+
+template <typename Derived>
+template <ValueLike T>
+inline bool RingBufferBase<Derived>::skip(SizeType itemCount) noexcept {
+    return skip(sizeof(T), itemCount, false) == itemCount;
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::drain() noexcept -> SizeType {
+    if (capacity() == 0) [[unlikely]] {
+        return 0;
+    }
+
+    const auto writePos = writePosition_.load(std::memory_order_acquire);
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    const auto bytesUsed = writePos - readPos;
+    cachedWritePosition_ = writePos;
+
+    if (bytesUsed == 0) [[unlikely]] {
+        return 0;
+    }
+
+    readPosition_.store(writePos, std::memory_order_release);
+    consumerStatistics_.recordRead(readPos, bytesUsed, producerStatistics_);
+    return bytesUsed;
+}
+
+// MARK: Advanced Writing and Reading
+
+template <typename Derived> inline auto RingBufferBase<Derived>::writeVector() const noexcept -> WriteVector {
+    return writeVector(capacity());
+}
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::writeVector(SizeType count) const noexcept -> WriteVector {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto bytesFree = writableBytes(writePos, count);
+
+    if (bytesFree == 0) [[unlikely]] {
+        return {};
+    }
+
+    auto *dst = storage();
+    const auto writeIndex = writePos & capacityMask();
+    const auto bytesToEnd = extent() - writeIndex;
+
+    if (bytesFree > bytesToEnd) [[unlikely]] {
+        return {{dst + writeIndex, bytesToEnd}, {dst, bytesFree - bytesToEnd}};
+    }
+    return {{dst + writeIndex, bytesFree}, {}};
+}
+
+template <typename Derived> inline void RingBufferBase<Derived>::commitWrite(SizeType count) noexcept {
+    assert(count <= freeSpace() && "Logic error: Write committing more than available free space");
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    producerStatistics_.recordWrite(writePos, count, crossesEnd(writePos, count));
+    writePosition_.store(writePos + count, std::memory_order_release);
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::readVector() const noexcept -> ReadVector {
+    return readVector(capacity());
+}
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::readVector(SizeType count) const noexcept -> ReadVector {
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    const auto bytesUsed = readableBytes(readPos, count);
+
+    if (bytesUsed == 0) [[unlikely]] {
+        return {};
+    }
+
+    const auto *src = storage();
+    const auto readIndex = readPos & capacityMask();
+    const auto bytesToEnd = extent() - readIndex;
+
+    if (bytesUsed > bytesToEnd) [[unlikely]] {
+        return {{src + readIndex, bytesToEnd}, {src, bytesUsed - bytesToEnd}};
+    }
+    return {{src + readIndex, bytesUsed}, {}};
+}
+
+template <typename Derived> inline void RingBufferBase<Derived>::commitRead(SizeType count) noexcept {
+    assert(count <= availableBytes() && "Logic error: Read committing more than available data");
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    readPosition_.store(readPos + count, std::memory_order_release);
+    consumerStatistics_.recordRead(readPos, count, producerStatistics_);
+}
+
+// MARK: Typed Writing and Reading
+
+template <typename Derived>
+template <ByteCopyable T>
+inline auto RingBufferBase<Derived>::writeVector() const noexcept -> std::pair<std::span<T>, std::span<T>> {
+    if (!isElementBoundary<T>(writePosition_.load(std::memory_order_relaxed))) [[unlikely]] {
+        return {};
+    }
+
+    const auto [front, back] = writeVector();
+    const auto frontCount = front.size() / sizeof(T);
+    const auto backCount = (front.size() + back.size()) / sizeof(T) - frontCount;
+    return {{reinterpret_cast<T *>(front.data()), frontCount}, {reinterpret_cast<T *>(back.data()), backCount}};
+}
+
+template <typename Derived>
+template <ByteCopyable T>
+inline void RingBufferBase<Derived>::commitWrite(SizeType count) noexcept {
+    commitWrite(count * sizeof(T));
+}
+
+template <typename Derived>
+template <ByteCopyable T>
+inline auto RingBufferBase<Derived>::readVector() const noexcept -> std::pair<std::span<const T>, std::span<const T>> {
+    if (!isElementBoundary<T>(readPosition_.load(std::memory_order_relaxed))) [[unlikely]] {
+        return {};
+    }
+
+    const auto [front, back] = readVector();
+    const auto frontCount = front.size() / sizeof(T);
+    const auto backCount = (front.size() + back.size()) / sizeof(T) - frontCount;
+    return {{reinterpret_cast<const T *>(front.data()), frontCount},
+            {reinterpret_cast<const T *>(back.data()), backCount}};
+}
+
+template <typename Derived>
+template <ByteCopyable T>
+inline void RingBufferBase<Derived>::commitRead(SizeType count) noexcept {
+    commitRead(count * sizeof(T));
+}
+
+// MARK: In-Place Processing
+
+template <typename Derived>
+template <typename F>
+    requires std::is_invocable_r_v<typename RingBufferBase<Derived>::SizeType, F &, std::span<std::byte>>
+inline auto RingBufferBase<Derived>::produce(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<std::byte>>)
+        -> SizeType {
+    const auto [front, back] = writeVector();
+    const auto produced = processRegions(std::pair{std::as_writable_bytes(front), std::as_writable_bytes(back)}, f);
+    if (produced > 0) {
+        commitWrite(produced);
+    }
+    return produced;
+}
+
+template <typename Derived>
+template <ByteCopyable T, typename F>
+    requires std::is_invocable_r_v<typename RingBufferBase<Derived>::SizeType, F &, std::span<T>>
+inline auto RingBufferBase<Derived>::produce(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<T>>)
+        -> SizeType {
+    const auto produced = processRegions(writeVector<T>(), f);
+    if (produced > 0) {
+        commitWrite<T>(produced);
+    }
+    return produced;
+}
+
+template <typename Derived>
+template <typename F>
+    requires std::is_invocable_r_v<typename RingBufferBase<Derived>::SizeType, F &, std::span<const std::byte>>
+inline auto RingBufferBase<Derived>::consume(F &&f) noexcept(
+        std::is_nothrow_invocable_v<F &, std::span<const std::byte>>) -> SizeType {
+    const auto [front, back] = readVector();
+    const auto consumed = processRegions(std::pair{std::as_bytes(front), std::as_bytes(back)}, f);
+    if (consumed > 0) {
+        commitRead(consumed);
+    }
+    return consumed;
+}
+
+template <typename Derived>
+template <ByteCopyable T, typename F>
+    requires std::is_invocable_r_v<typename RingBufferBase<Derived>::SizeType, F &, std::span<const T>>
+inline auto RingBufferBase<Derived>::consume(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<const T>>)
+        -> SizeType {
+    const auto consumed = processRegions(readVector<T>(), f);
+    if (consumed > 0) {
+        commitRead<T>(consumed);
+    }
+    return consumed;
+}
+
+template <typename Derived>
+template <typename T, typename F>
+inline auto RingBufferBase<Derived>::processRegions(std::pair<std::span<T>, std::span<T>> regions, F &f) noexcept(
+        std::is_nothrow_invocable_v<F &, std::span<T>>) -> SizeType {
+    SizeType total = 0;
+    for (const auto region : {regions.first, regions.second}) {
+        if (region.empty()) {
+            break;
+        }
+        const auto processed = std::min(static_cast<SizeType>(std::invoke(f, region)), region.size());
+        total += processed;
+        if (processed < region.size()) {
+            break;
+        }
+    }
+    return total;
+}
+
+// MARK: Blocking Writing and Reading
+
+template <typename Derived>
+template <typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::writeWait(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                               W &&strategy) noexcept {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || itemCount > capacity() / itemSize) [[unlikely]] {
+        return false;
+    }
+
+    if (write(ptr, itemSize, itemCount, false) == 0) {
+        waitForSpace(itemSize * itemCount, nullptr, strategy);
+        write(ptr, itemSize, itemCount, false);
+    }
+
+    notifyConsumer();
+    return true;
+}
+
+template <typename Derived>
+template <ByteCopyable T, typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::writeWait(std::span<const T> data, W &&strategy) noexcept {
+    return writeWait(data.data(), sizeof(T), data.size(), strategy);
+}
+
+template <typename Derived>
+template <typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::writeWait(ValueLike auto const &value, W &&strategy) noexcept {
+    if (sizeof value > capacity()) [[unlikely]] {
+        return false;
+    }
+
+    if (!write(value)) {
+        waitForSpace(sizeof value, nullptr, strategy);
+        write(value);
+    }
+
+    notifyConsumer();
+    return true;
+}
+
+template <typename Derived>
+template <typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::readWait(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                              W &&strategy) noexcept {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || itemCount > capacity() / itemSize) [[unlikely]] {
+        return false;
+    }
+
+    if (read(ptr, itemSize, itemCount, false) == 0) {
+        waitForData(itemSize * itemCount, nullptr, strategy);
+        read(ptr, itemSize, itemCount, false);
+    }
+
+    notifyProducer();
+    return true;
+}
+
+template <typename Derived>
+template <ByteCopyable T, typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::readWait(std::span<T> buffer, W &&strategy) noexcept {
+    return readWait(buffer.data(), sizeof(T), buffer.size(), strategy);
+}
+
+template <typename Derived>
+template <typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::readWait(ValueLike auto &value, W &&strategy) noexcept {
+    if (sizeof value > capacity()) [[unlikely]] {
+        return false;
+    }
+
+    if (!read(value)) {
+        waitForData(sizeof value, nullptr, strategy);
+        read(value);
+    }
+
+    notifyProducer();
+    return true;
+}
+
+template <typename Derived>
+template <typename Rep, typename Period, typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::readFor(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                             const std::chrono::duration<Rep, Period> &timeout,
+                                             W &&strategy) noexcept {
+    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || itemCount > capacity() / itemSize) [[unlikely]] {
+        return false;
+    }
+
+    if (read(ptr, itemSize, itemCount, false) == 0) {
+        const auto deadline =
+                std::chrono::steady_clock::now() + std::chrono::ceil<std::chrono::steady_clock::duration>(timeout);
+        if (!waitForData(itemSize * itemCount, &deadline, strategy)) {
+            return false;
+        }
+        read(ptr, itemSize, itemCount, false);
+    }
+
+    notifyProducer();
+    return true;
+}
+
+template <typename Derived>
+template <typename Rep, typename Period, typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::readFor(ValueLike auto &value, const std::chrono::duration<Rep, Period> &timeout,
+                                             W &&strategy) noexcept {
+    if (sizeof value > capacity()) [[unlikely]] {
+        return false;
+    }
+
+    if (!read(value)) {
+        const auto deadline =
+                std::chrono::steady_clock::now() + std::chrono::ceil<std::chrono::steady_clock::duration>(timeout);
+        if (!waitForData(sizeof value, &deadline, strategy)) {
+            return false;
+        }
+        read(value);
+    }
+
+    notifyProducer();
+    return true;
+}
+
+template <typename Derived>
+template <ValueLike T, typename Rep, typename Period, typename W>
+    requires std::default_initializable<T> && WaitStrategy<std::remove_cvref_t<W>>
+inline auto RingBufferBase<Derived>::readFor(const std::chrono::duration<Rep, Period> &timeout, W &&strategy) noexcept(
+        std::is_nothrow_default_constructible_v<T>) -> std::optional<T> {
+    if (std::optional<T> result; readFor(result.emplace(), timeout, strategy)) {
+        return result;
+    }
+    return std::nullopt;
+}
+
+template <typename Derived> inline void RingBufferBase<Derived>::notifyConsumer() noexcept {
+    // Pairs with the fence in waitForData: either the consumer observes the new write position or this observes the
+    // consumer's flag
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (dataWaiter_.load(std::memory_order_relaxed) != 0 && dataWaiter_.exchange(0, std::memory_order_relaxed) != 0) {
+        detail::wakeAddress(dataWaiter_, detail::isProcessShared<Derived>);
+    }
+    resumeAwaiter<false>();
+}
+
+template <typename Derived> inline void RingBufferBase<Derived>::notifyProducer() noexcept {
+    // Pairs with the fence in waitForSpace: either the producer observes the new read position or this observes the
+    // producer's flag
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (spaceWaiter_.load(std::memory_order_relaxed) != 0 &&
+        spaceWaiter_.exchange(0, std::memory_order_relaxed) != 0) {
+        detail::wakeAddress(spaceWaiter_, detail::isProcessShared<Derived>);
+    }
+    resumeAwaiter<true>();
+}
+
+template <typename Derived>
+template <WaitStrategy W>
+inline bool RingBufferBase<Derived>::waitForSpace(SizeType count,
+                                                  const std::chrono::steady_clock::time_point *deadline,
+                                                  W &strategy) noexcept {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto reload = [&]() noexcept {
+        reloadReadPosition(writePos);
+        return capacity() - (writePos - cachedReadPosition_);
+    };
+    return waitUntilReady(spaceWaiter_, reload, count, deadline, strategy);
+}
+
+template <typename Derived>
+template <WaitStrategy W>
+inline bool RingBufferBase<Derived>::waitForData(SizeType count,
+                                                 const std::chrono::steady_clock::time_point *deadline,
+                                                 W &strategy) noexcept {
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    const auto reload = [&]() noexcept {
+        reloadWritePosition(readPos);
+        return cachedWritePosition_ - readPos;
+    };
+    return waitUntilReady(dataWaiter_, reload, count, deadline, strategy);
+}
+
+template <typename Derived>
+template <WaitStrategy W, typename Reload>
+inline bool RingBufferBase<Derived>::waitUntilReady(std::atomic<std::uint32_t> &waiter, Reload &&reload,
+                                                    SizeType count,
+                                                    const std::chrono::steady_clock::time_point *deadline,
+                                                    W &strategy) noexcept {
+    for (std::uint32_t attempt = 0;; attempt += attempt < std::numeric_limits<std::uint32_t>::max() ? 1 : 0) {
+        if (reload() >= count) {
+            return true;
+        }
+
+        std::chrono::nanoseconds remaining{};
+        if (deadline != nullptr) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= *deadline) {
+                return false;
+            }
+            remaining = *deadline - now;
+        }
+
+        if (!detail::idle(strategy, attempt)) {
+            continue;
+        }
+
+        // Announce the intent to sleep, then check again so that a position stored before the other side could
+        // observe the flag is not missed. Pairs with the fences in notifyConsumer and notifyProducer.
+        waiter.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (reload() >= count) {
+            waiter.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        detail::waitOnAddress(waiter, 1, deadline != nullptr ? &remaining : nullptr, detail::isProcessShared<Derived>);
+        waiter.store(0, std::memory_order_relaxed);
+    }
+}
+
+// MARK: Awaiting
+
+template <typename Derived>
+template <bool Space>
+inline RingBufferBase<Derived>::Awaiter<Space>::Awaiter(RingBufferBase &ring,
+                                                       detail::Continuation continuation) noexcept
+    : ring_{ring}, continuation_{continuation} {}
+
+template <typename Derived>
+template <bool Space>
+inline bool RingBufferBase<Derived>::Awaiter<Space>::await_ready() const noexcept {
+    return continuation_.count > ring_.capacity() || ring_.template isReady<Space>(continuation_.count);
+}
+
+template <typename Derived>
+template <bool Space>
+inline bool RingBufferBase<Derived>::Awaiter<Space>::await_suspend(std::coroutine_handle<> coroutine) noexcept {
+    continuation_.coroutine = coroutine;
+    return ring_.template suspend<Space>(continuation_);
+}
+
+template <typename Derived>
+template <bool Space>
+inline bool RingBufferBase<Derived>::Awaiter<Space>::await_resume() const noexcept {
+    return continuation_.count <= ring_.capacity();
+}
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::readable(SizeType count) noexcept -> ReadableAwaiter
+    requires(!detail::isProcessShared<Derived>) {
+    return {*this, {.count = count}};
+}
+
+template <typename Derived>
+template <typename S>
+    requires std::is_nothrow_invocable_v<S &, std::coroutine_handle<>> && (!detail::isProcessShared<Derived>)
+inline auto RingBufferBase<Derived>::readable(SizeType count, S &scheduler) noexcept -> ReadableAwaiter {
+    const auto schedule = [](void *context, std::coroutine_handle<> coroutine) noexcept {
+        std::invoke(*static_cast<S *>(context), coroutine);
+    };
+    return {*this, {.count = count, .schedule = schedule, .scheduler = std::addressof(scheduler)}};
+}
+
+template <typename Derived>
+inline auto RingBufferBase<Derived>::writable(SizeType count) noexcept -> WritableAwaiter
+    requires(!detail::isProcessShared<Derived>) {
+    return {*this, {.count = count}};
+}
+
+template <typename Derived>
+template <typename S>
+    requires std::is_nothrow_invocable_v<S &, std::coroutine_handle<>> && (!detail::isProcessShared<Derived>)
+inline auto RingBufferBase<Derived>::writable(SizeType count, S &scheduler) noexcept -> WritableAwaiter {
+    const auto schedule = [](void *context, std::coroutine_handle<> coroutine) noexcept {
+        std::invoke(*static_cast<S *>(context), coroutine);
+    };
+    return {*this, {.count = count, .schedule = schedule, .scheduler = std::addressof(scheduler)}};
+}
+
+template <typename Derived>
+inline bool RingBufferBase<Derived>::armReadable(EventNotifier &notifier) noexcept
+    requires(!detail::isProcessShared<Derived>) {
+    return suspend<false>(notifier.continuation_);
+}
+
+template <typename Derived>
+inline bool RingBufferBase<Derived>::armWritable(EventNotifier &notifier) noexcept
+    requires(!detail::isProcessShared<Derived>) {
+    return suspend<true>(notifier.continuation_);
+}
+
+template <typename Derived>
+inline void RingBufferBase<Derived>::disarm(EventNotifier &notifier) noexcept
+    requires(!detail::isProcessShared<Derived>) {
+    for (auto *const slot : {&dataAwaiter_, &spaceAwaiter_}) {
+        withdraw(*slot, &notifier.continuation_);
+    }
+}
+
+template <typename Derived>
+template <bool Space>
+inline bool RingBufferBase<Derived>::isReady(SizeType count) const noexcept {
+    const auto used = writePosition_.load(std::memory_order_acquire) - readPosition_.load(std::memory_order_acquire);
+    return (Space ? capacity() - used : used) >= count;
+}
+
+template <typename Derived>
+template <bool Space>
+inline bool RingBufferBase<Derived>::suspend(detail::Continuation &continuation) noexcept {
+    auto &slot = Space ? spaceAwaiter_ : dataAwaiter_;
+    // Once published the continuation may be resumed and destroyed by the other side at any time
+    const auto count = continuation.count;
+    auto *const published = &continuation;
+
+    // Announce the coroutine, then check again so that a position stored before the other side could observe it is
+    // not missed. Pairs with the fences in notifyConsumer and notifyProducer.
+    slot.store(&continuation, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!isReady<Space>(count)) {
+        return true;
+    }
+
+    // Withdraw the coroutine unless the other side has already taken it to resume
+    return !withdraw(slot, published);
+}
+
+template <typename Derived>
+inline bool RingBufferBase<Derived>::withdraw(std::atomic<detail::Continuation *> &slot,
+                                              detail::Continuation *const RB_NONNULL continuation) noexcept {
+    auto *expected = continuation;
+    while (!slot.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        if (expected != &detail::busyContinuation) {
+            return false;
+        }
+        cpuRelax();
+        expected = continuation;
+    }
+    return true;
+}
+
+template <typename Derived>
+template <bool Space>
+inline void RingBufferBase<Derived>::resumeAwaiter() noexcept {
+    auto &slot = Space ? spaceAwaiter_ : dataAwaiter_;
+    auto *continuation = slot.load(std::memory_order_relaxed);
+    if (continuation == nullptr) [[likely]] {
+        return;
+    }
+
+    // Claiming the continuation before examining it ensures its count belongs to the suspended coroutine, and keeps
+    // it from being withdrawn or disarmed until this side is done with it
+    if (!slot.compare_exchange_strong(continuation, &detail::busyContinuation, std::memory_order_acquire,
+                                      std::memory_order_relaxed)) {
+        // Withdrawn by the waiting side, which found its condition held
+        return;
+    }
+    if (!isReady<Space>(continuation->count)) {
+        // The coroutine remains suspended and only this side can make its condition hold
+        slot.store(continuation, std::memory_order_release);
+        return;
+    }
+
+    if (continuation->schedule == nullptr) {
+        // Resuming the coroutine may suspend it again, so the slot is released first
+        const auto coroutine = continuation->coroutine;
+        slot.store(nullptr, std::memory_order_release);
+        coroutine.resume();
+    } else {
+        // A scheduler, or notifier, is only passed the coroutine, so the slot is released once it returns. A coroutine
+        // the scheduler resumes inline may already have replaced the claim.
+        continuation->resume();
+        auto *expected = &detail::busyContinuation;
+        slot.compare_exchange_strong(expected, nullptr, std::memory_order_release, std::memory_order_relaxed);
+    }
+}
+
+// MARK: Batched Writing and Reading
+
+template <typename Derived>
+inline RingBufferBase<Derived>::WriteBatch::WriteBatch(RingBufferBase &ring) noexcept : ring_{ring} {}
+
+template <typename Derived> inline RingBufferBase<Derived>::WriteBatch::~WriteBatch() noexcept { commit(); }
+
+template <typename Derived>
+inline bool RingBufferBase<Derived>::WriteBatch::append(const void *const RB_NONNULL ptr, SizeType size) noexcept {
+    if (ptr == nullptr) [[unlikely]] {
         return false;
     }
-    commitRead((sizeof args + ...));
+    if (size == 0) [[unlikely]] {
+        return true;
+    }
+    return appendUpTo<std::numeric_limits<std::size_t>::max()>(static_cast<const unsigned char *>(ptr), size);
+}
+
+template <typename Derived>
+template <std::size_t MaxSize>
+inline bool RingBufferBase<Derived>::WriteBatch::appendUpTo(const unsigned char *const RB_NONNULL src,
+                                                           SizeType size) noexcept {
+    const auto required = size_ + size;
+    if (vector_.first.size() + vector_.second.size() < required) {
+        // The write position has not moved so the staged bytes remain at the front of the refreshed vector
+        vector_ = ring_.writeVector(required);
+        if (vector_.first.size() + vector_.second.size() < required) {
+            return false;
+        }
+    }
+
+    auto [front, back] = vector_;
+    const auto frontSize = front.size();
+
+    if (required <= frontSize) [[likely]] {
+        detail::copyUpTo<MaxSize>(front.data() + size_, src, size);
+    } else if (size_ >= frontSize) {
+        detail::copyUpTo<MaxSize>(back.data() + (size_ - frontSize), src, size);
+    } else if constexpr (MaxSize > 1) {
+        // Only data of more than one byte can straddle the end of the buffer
+        const auto toFront = frontSize - size_;
+        detail::copyUpTo<MaxSize>(front.data() + size_, src, toFront);
+        detail::copyUpTo<MaxSize>(back.data(), src + toFront, size - toFront);
+    }
+
+    size_ = required;
     return true;
 }
 
-template <ValueLike... Args>
-    requires(sizeof...(Args) > 1) && (std::default_initializable<Args> && ...)
-inline auto RingBuffer::readAll() noexcept((std::is_nothrow_default_constructible_v<Args> && ...))
-        -> std::optional<std::tuple<Args...>> {
-    auto result = peekAll<Args...>();
-    if (!result) {
-        return std::nullopt;
+template <typename Derived>
+template <ByteCopyable T>
+inline bool RingBufferBase<Derived>::WriteBatch::append(std::span<const T> data) noexcept {
+    return append(data.data(), data.size_bytes());
+}
+
+template <typename Derived>
+inline bool RingBufferBase<Derived>::WriteBatch::append(ValueLike auto const &value) noexcept {
+    return appendUpTo<sizeof value>(reinterpret_cast<const unsigned char *>(std::addressof(value)), sizeof value);
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::WriteBatch::size() const noexcept -> SizeType {
+    return size_;
+}
+
+template <typename Derived> inline void RingBufferBase<Derived>::WriteBatch::commit() noexcept {
+    if (size_ > 0) {
+        ring_.commitWrite(size_);
+        vector_ = {};
+        size_ = 0;
     }
-    commitRead((sizeof(Args) + ...));
-    return result;
 }
 
-// MARK: Peeking
+template <typename Derived> inline void RingBufferBase<Derived>::WriteBatch::cancel() noexcept { size_ = 0; }
 
-inline bool RingBuffer::peek(void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount) const noexcept {
-    if (ptr == nullptr || itemSize == 0 || itemCount == 0 || capacity_ == 0) [[unlikely]] {
+template <typename Derived>
+inline RingBufferBase<Derived>::ReadBatch::ReadBatch(RingBufferBase &ring) noexcept : ring_{ring} {}
+
+template <typename Derived> inline RingBufferBase<Derived>::ReadBatch::~ReadBatch() noexcept { commit(); }
+
+template <typename Derived>
+inline bool RingBufferBase<Derived>::ReadBatch::read(void *const RB_NONNULL ptr, SizeType size) noexcept {
+    if (!peek(ptr, size)) {
         return false;
     }
+    size_ += size;
+    return true;
+}
 
-    const auto writePos = writePosition_.load(std::memory_order_acquire);
-    const auto readPos = readPosition_.load(std::memory_order_relaxed);
-    const auto bytesUsed = writePos - readPos;
-    const auto itemsAvailable = bytesUsed / itemSize;
+template <typename Derived>
+template <ByteCopyable T>
+inline bool RingBufferBase<Derived>::ReadBatch::read(std::span<T> buffer) noexcept {
+    return read(buffer.data(), buffer.size_bytes());
+}
 
-    if (itemsAvailable < itemCount) {
+template <typename Derived> inline bool RingBufferBase<Derived>::ReadBatch::read(ValueLike auto &value) noexcept {
+    return read(std::addressof(value), sizeof value);
+}
+
+template <typename Derived>
+inline bool RingBufferBase<Derived>::ReadBatch::peek(void *const RB_NONNULL ptr, SizeType size) const noexcept {
+    if (ptr == nullptr || !reserve(size)) [[unlikely]] {
         return false;
     }
+    if (size > 0) [[likely]] {
+        copy(ptr, size);
+    }
+    return true;
+}
 
-    const auto bytesToPeek = itemCount * itemSize;
+template <typename Derived> inline bool RingBufferBase<Derived>::ReadBatch::peek(ValueLike auto &value) const noexcept {
+    return peek(std::addressof(value), sizeof value);
+}
+
+template <typename Derived> inline bool RingBufferBase<Derived>::ReadBatch::skip(SizeType size) noexcept {
+    if (!reserve(size)) {
+        return false;
+    }
+    size_ += size;
+    return true;
+}
+
+template <typename Derived>
+template <typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingBufferBase<Derived>::ReadBatch::wait(SizeType count, W &&strategy) noexcept {
+    if (reserve(count)) [[likely]] {
+        return true;
+    }
+    if (count > ring_.capacity()) [[unlikely]] {
+        return false;
+    }
+
+    if (size_ > 0) {
+        commit();
+        ring_.notifyProducer();
+    }
+    ring_.waitForData(count, nullptr, strategy);
+    return reserve(count);
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::ReadBatch::size() const noexcept -> SizeType {
+    return size_;
+}
+
+template <typename Derived> inline void RingBufferBase<Derived>::ReadBatch::commit() noexcept {
+    if (size_ > 0) {
+        ring_.commitRead(size_);
+        vector_ = {};
+        size_ = 0;
+    }
+}
+
+template <typename Derived> inline void RingBufferBase<Derived>::ReadBatch::cancel() noexcept { size_ = 0; }
+
+template <typename Derived> inline bool RingBufferBase<Derived>::ReadBatch::reserve(SizeType count) const noexcept {
+    const auto required = size_ + count;
+    if (vector_.first.size() + vector_.second.size() >= required) [[likely]] {
+        return true;
+    }
+    // The read position has not moved so the consumed bytes remain at the front of the refreshed vector
+    vector_ = ring_.readVector(required);
+    return vector_.first.size() + vector_.second.size() >= required;
+}
+
+template <typename Derived>
+inline void RingBufferBase<Derived>::ReadBatch::copy(void *const RB_NONNULL ptr, SizeType count) const noexcept {
+    auto [front, back] = vector_;
+    const auto frontSize = front.size();
     auto *dst = static_cast<unsigned char *>(ptr);
-    const auto *src = static_cast<const unsigned char *>(buffer_);
-    const auto readIndex = readPos & capacityMask_;
-    const auto bytesToEnd = capacity_ - readIndex;
 
-    if (bytesToPeek <= bytesToEnd) [[likely]] {
-        std::memcpy(dst, src + readIndex, bytesToPeek);
+    if (size_ + count <= frontSize) [[likely]] {
+        std::memcpy(dst, front.data() + size_, count);
+    } else if (size_ >= frontSize) {
+        std::memcpy(dst, back.data() + (size_ - frontSize), count);
     } else [[unlikely]] {
-        std::memcpy(dst, src + readIndex, bytesToEnd);
-        std::memcpy(dst + bytesToEnd, src, bytesToPeek - bytesToEnd);
+        const auto fromFront = frontSize - size_;
+        std::memcpy(dst, front.data() + size_, fromFront);
+        std::memcpy(dst + fromFront, back.data(), count - fromFront);
     }
+}
 
-    return true;
+// MARK: Cached Positions
+
+template <typename Derived> inline void RingBufferBase<Derived>::reloadReadPosition(SizeType writePos) const noexcept {
+    cachedReadPosition_ = readPosition_.load(std::memory_order_acquire);
+    producerStatistics_.recordOccupancy(writePos - cachedReadPosition_);
 }
 
-template <ByteCopyable T> inline bool RingBuffer::peek(std::span<T> buffer) const noexcept {
-    return peek(buffer.data(), sizeof(T), buffer.size());
+template <typename Derived> inline void RingBufferBase<Derived>::reloadWritePosition(SizeType readPos) const noexcept {
+    cachedWritePosition_ = writePosition_.load(std::memory_order_acquire);
+    consumerStatistics_.recordOccupancy(cachedWritePosition_ - readPos);
 }
 
-inline bool RingBuffer::peek(ValueLike auto &value) const noexcept {
-    return peek(std::addressof(value), sizeof value, 1);
+template <typename Derived>
+inline bool RingBufferBase<Derived>::crossesEnd(SizeType pos, SizeType count) const noexcept {
+    return (pos & capacityMask()) + count > capacity();
 }
 
-template <ValueLike T>
-    requires std::default_initializable<T>
-inline auto RingBuffer::peek() const noexcept(std::is_nothrow_default_constructible_v<T>) -> std::optional<T> {
-    if (std::optional<T> result; peek(result.emplace())) {
-        return result;
+template <typename Derived>
+inline auto RingBufferBase<Derived>::writableBytes(SizeType writePos, SizeType count) const noexcept -> SizeType {
+    if (const auto bytesFree = capacity() - (writePos - cachedReadPosition_); bytesFree >= count) [[likely]] {
+        return bytesFree;
     }
-    return std::nullopt;
+    reloadReadPosition(writePos);
+    return capacity() - (writePos - cachedReadPosition_);
 }
 
-template <ValueLike... Args>
-    requires(sizeof...(Args) > 1) && (std::assignable_from<Args &, const Args &> && ...)
-inline bool RingBuffer::peekAll(Args &...args) const noexcept {
-    constexpr auto totalSize = (sizeof args + ...);
-    auto [front, back] = readVector();
-    const auto frontSize = front.size();
+template <typename Derived>
+inline auto RingBufferBase<Derived>::readableBytes(SizeType readPos, SizeType count) const noexcept -> SizeType {
+    if (const auto bytesUsed = cachedWritePosition_ - readPos; bytesUsed >= count) [[likely]] {
+        return bytesUsed;
+    }
+    reloadWritePosition(readPos);
+    return cachedWritePosition_ - readPos;
+}
 
-    if (frontSize + back.size() < totalSize) {
+template <typename Derived>
+template <std::size_t Size>
+inline bool RingBufferBase<Derived>::writeFixed(const unsigned char *const RB_NONNULL src) noexcept {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    if (writableBytes(writePos, Size) < Size) {
+        producerStatistics_.recordFull();
         return false;
     }
 
-    std::size_t cursor = 0;
-    const auto readArg = [&](void *arg, std::size_t len) noexcept {
-        auto *dst = static_cast<unsigned char *>(arg);
-        if (cursor + len <= frontSize) {
-            std::memcpy(dst, front.data() + cursor, len);
-        } else if (cursor >= frontSize) {
-            std::memcpy(dst, back.data() + (cursor - frontSize), len);
-        } else [[unlikely]] {
-            const std::size_t fromFront = frontSize - cursor;
-            std::memcpy(dst, front.data() + cursor, fromFront);
-            std::memcpy(dst + fromFront, back.data(), len - fromFront);
-        }
-        cursor += len;
-    };
+    auto *dst = storage();
+    const auto writeIndex = writePos & capacityMask();
+    const auto bytesToEnd = extent() - writeIndex;
 
-    (readArg(std::addressof(args), sizeof args), ...);
+    if (Size <= bytesToEnd) [[likely]] {
+        std::memcpy(dst + writeIndex, src, Size);
+    } else [[unlikely]] {
+        detail::copyUpTo<Size>(dst + writeIndex, src, bytesToEnd);
+        detail::copyUpTo<Size>(dst, src + bytesToEnd, Size - bytesToEnd);
+    }
+
+    producerStatistics_.recordWrite(writePos, Size, crossesEnd(writePos, Size));
+    writePosition_.store(writePos + Size, std::memory_order_release);
     return true;
 }
 
-template <ValueLike... Args>
-    requires(sizeof...(Args) > 1) && (std::default_initializable<Args> && ...)
-inline auto RingBuffer::peekAll() const noexcept((std::is_nothrow_default_constructible_v<Args> && ...))
-        -> std::optional<std::tuple<Args...>> {
-    if (std::tuple<Args...> result; std::apply([&](Args &...args) noexcept { return peekAll(args...); }, result)) {
-        return result;
+template <typename Derived>
+template <std::size_t Size>
+inline bool RingBufferBase<Derived>::peekFixed(SizeType readPos, unsigned char *const RB_NONNULL dst) const noexcept {
+    if (readableBytes(readPos, Size) < Size) {
+        return false;
     }
-    return std::nullopt;
-}
 
-// MARK: Discarding Data
+    const auto *src = storage();
+    const auto readIndex = readPos & capacityMask();
+    const auto bytesToEnd = extent() - readIndex;
 
-inline auto RingBuffer::skip(SizeType itemSize, SizeType itemCount, bool allowPartial) noexcept -> SizeType {
-    if (itemSize == 0 || itemCount == 0 || capacity_ == 0) [[unlikely]] {
-        return 0;
+    if (Size <= bytesToEnd) [[likely]] {
+        std::memcpy(dst, src + readIndex, Size);
+    } else [[unlikely]] {
+        detail::copyUpTo<Size>(dst, src + readIndex, bytesToEnd);
+        detail::copyUpTo<Size>(dst + bytesToEnd, src, Size - bytesToEnd);
     }
+    return true;
+}
 
-    const auto writePos = writePosition_.load(std::memory_order_acquire);
+template <typename Derived>
+template <std::size_t Size>
+inline bool RingBufferBase<Derived>::readFixed(unsigned char *const RB_NONNULL dst) noexcept {
     const auto readPos = readPosition_.load(std::memory_order_relaxed);
-    const auto bytesUsed = writePos - readPos;
-    const auto itemsAvailable = bytesUsed / itemSize;
+    if (!peekFixed<Size>(readPos, dst)) {
+        consumerStatistics_.recordEmpty();
+        return false;
+    }
 
-    if (itemsAvailable == 0 || (itemsAvailable < itemCount && !allowPartial)) {
-        return 0;
+    readPosition_.store(readPos + Size, std::memory_order_release);
+    consumerStatistics_.recordRead(readPos, Size, producerStatistics_);
+    return true;
+}
+
+// MARK: Positions
+
+template <typename Derived> inline void RingBufferBase<Derived>::resetPositions() noexcept {
+    writePosition_.store(0, std::memory_order_relaxed);
+    cachedReadPosition_ = 0;
+    readPosition_.store(0, std::memory_order_relaxed);
+    cachedWritePosition_ = 0;
+    dataWaiter_.store(0, std::memory_order_relaxed);
+    spaceWaiter_.store(0, std::memory_order_relaxed);
+    dataAwaiter_.store(nullptr, std::memory_order_relaxed);
+    spaceAwaiter_.store(nullptr, std::memory_order_relaxed);
+    producerStatistics_.reset();
+    consumerStatistics_.reset();
+}
+
+template <typename Derived> inline void RingBufferBase<Derived>::movePositions(RingBufferBase &other) noexcept {
+    writePosition_.store(other.writePosition_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    cachedReadPosition_ = std::exchange(other.cachedReadPosition_, 0);
+    readPosition_.store(other.readPosition_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    cachedWritePosition_ = std::exchange(other.cachedWritePosition_, 0);
+    producerStatistics_.take(other.producerStatistics_);
+    consumerStatistics_.take(other.consumerStatistics_);
+}
+
+// MARK: Storage
+
+template <typename Derived> inline auto RingBufferBase<Derived>::storage() const noexcept -> unsigned char * {
+    return static_cast<const Derived &>(*this).storageData();
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::capacityMask() const noexcept -> SizeType {
+    return static_cast<const Derived &>(*this).storageMask();
+}
+
+template <typename Derived> inline auto RingBufferBase<Derived>::extent() const noexcept -> SizeType {
+    return static_cast<const Derived &>(*this).storageExtent();
+}
+
+template <typename Derived>
+template <typename T>
+inline bool RingBufferBase<Derived>::isElementBoundary(SizeType pos) const noexcept {
+    // Elements wrap cleanly if they tile the capacity, and never wrap if the buffer is mirrored
+    const auto *element = storage() + (pos & capacityMask());
+    return pos % sizeof(T) == 0 && (capacity() % sizeof(T) == 0 || isMirrored()) &&
+           reinterpret_cast<std::uintptr_t>(element) % alignof(T) == 0;
+}
+
+// MARK: - BasicRingBuffer
+
+template <typename Statistics>
+inline BasicRingBuffer<Statistics>::BasicRingBuffer(SizeType minCapacity)
+    : BasicRingBuffer(minCapacity, AllocationOptions{}) {}
+
+template <typename Statistics>
+inline BasicRingBuffer<Statistics>::BasicRingBuffer(SizeType minCapacity, const AllocationOptions &options) {
+    if (minCapacity < Base::minCapacity || minCapacity > Base::maxCapacity) [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
+    if (!allocate(minCapacity, options)) [[unlikely]] {
+        throw std::bad_alloc();
     }
+}
 
-    const auto itemsToSkip = std::min(itemsAvailable, itemCount);
-    const auto bytesToSkip = itemsToSkip * itemSize;
+template <typename Statistics>
+inline BasicRingBuffer<Statistics>::BasicRingBuffer(SizeType minCapacity, std::pmr::memory_resource &resource) {
+    if (minCapacity < Base::minCapacity || minCapacity > Base::maxCapacity) [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
+    if (!allocate(minCapacity, resource)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
 
-    readPosition_.store(readPos + bytesToSkip, std::memory_order_release);
-    return itemsToSkip;
+template <typename Statistics>
+inline BasicRingBuffer<Statistics>::BasicRingBuffer(std::span<unsigned char> region) {
+    if (!adopt(region)) [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
 }
 
-template <ValueLike T> inline bool RingBuffer::skip(SizeType itemCount) noexcept {
-    return skip(sizeof(T), itemCount, false) == itemCount;
+template <typename Statistics>
+inline BasicRingBuffer<Statistics>::BasicRingBuffer(BasicRingBuffer &&other) noexcept
+    : storage_{std::move(other.storage_)} {
+    this->movePositions(other);
 }
 
-inline auto RingBuffer::drain() noexcept -> SizeType {
-    if (capacity_ == 0) [[unlikely]] {
-        return 0;
+template <typename Statistics>
+inline auto BasicRingBuffer<Statistics>::operator=(BasicRingBuffer &&other) noexcept -> BasicRingBuffer & {
+    if (this != &other) [[likely]] {
+        storage_ = std::move(other.storage_);
+        this->movePositions(other);
     }
+    return *this;
+}
 
-    const auto writePos = writePosition_.load(std::memory_order_acquire);
-    const auto readPos = readPosition_.load(std::memory_order_relaxed);
-    const auto bytesUsed = writePos - readPos;
+template <typename Statistics> inline bool BasicRingBuffer<Statistics>::allocate(SizeType minCapacity) noexcept {
+    return allocate(minCapacity, AllocationOptions{});
+}
 
-    if (bytesUsed == 0) [[unlikely]] {
-        return 0;
+template <typename Statistics>
+inline bool BasicRingBuffer<Statistics>::allocate(SizeType minCapacity, const AllocationOptions &options) noexcept {
+    if (minCapacity < Base::minCapacity || minCapacity > Base::maxCapacity) [[unlikely]] {
+        return false;
     }
 
-    readPosition_.store(writePos, std::memory_order_release);
-    return bytesUsed;
+    deallocate();
+    if (!storage_.allocate(minCapacity, options)) [[unlikely]] {
+        return false;
+    }
+    this->resetPositions();
+    return true;
 }
 
-// MARK: Advanced Writing and Reading
+template <typename Statistics>
+inline bool BasicRingBuffer<Statistics>::allocate(SizeType minCapacity, std::pmr::memory_resource &resource) noexcept {
+    if (minCapacity < Base::minCapacity || minCapacity > Base::maxCapacity) [[unlikely]] {
+        return false;
+    }
 
-inline auto RingBuffer::writeVector() const noexcept -> WriteVector {
-    const auto writePos = writePosition_.load(std::memory_order_relaxed);
-    const auto readPos = readPosition_.load(std::memory_order_acquire);
-    const auto bytesUsed = writePos - readPos;
-    const auto bytesFree = capacity_ - bytesUsed;
+    deallocate();
+    if (!storage_.allocate(minCapacity, resource)) [[unlikely]] {
+        return false;
+    }
+    this->resetPositions();
+    return true;
+}
 
-    if (bytesFree == 0) [[unlikely]] {
-        return {};
+template <typename Statistics>
+inline bool BasicRingBuffer<Statistics>::adopt(std::span<unsigned char> region) noexcept {
+    const auto capacity = region.size();
+    if (capacity < Base::minCapacity || capacity > Base::maxCapacity || !std::has_single_bit(capacity))
+            [[unlikely]] {
+        return false;
     }
 
-    auto *dst = static_cast<unsigned char *>(buffer_);
-    const auto writeIndex = writePos & capacityMask_;
-    const auto bytesToEnd = capacity_ - writeIndex;
+    deallocate();
+    storage_.adopt(region);
+    this->resetPositions();
+    return true;
+}
 
-    if (bytesFree > bytesToEnd) [[unlikely]] {
-        return {{dst + writeIndex, bytesToEnd}, {dst, bytesFree - bytesToEnd}};
+template <typename Statistics> inline void BasicRingBuffer<Statistics>::deallocate() noexcept {
+    if (storage_.deallocate()) [[likely]] {
+        this->resetPositions();
     }
-    return {{dst + writeIndex, bytesFree}, {}};
 }
 
-inline void RingBuffer::commitWrite(SizeType count) noexcept {
-    assert(count <= freeSpace() && "Logic error: Write committing more than available free space");
-    const auto writePos = writePosition_.load(std::memory_order_relaxed);
-    writePosition_.store(writePos + count, std::memory_order_release);
+template <typename Statistics>
+inline auto BasicRingBuffer<Statistics>::storageData() const noexcept -> unsigned char * {
+    return storage_.data();
 }
 
-inline auto RingBuffer::readVector() const noexcept -> ReadVector {
-    const auto writePos = writePosition_.load(std::memory_order_acquire);
-    const auto readPos = readPosition_.load(std::memory_order_relaxed);
-    const auto bytesUsed = writePos - readPos;
+template <typename Statistics> inline auto BasicRingBuffer<Statistics>::storageCapacity() const noexcept -> SizeType {
+    return storage_.capacity();
+}
 
-    if (bytesUsed == 0) [[unlikely]] {
-        return {};
-    }
+template <typename Statistics> inline auto BasicRingBuffer<Statistics>::storageMask() const noexcept -> SizeType {
+    return storage_.mask();
+}
 
-    const auto *src = static_cast<const unsigned char *>(buffer_);
-    const auto readIndex = readPos & capacityMask_;
-    const auto bytesToEnd = capacity_ - readIndex;
+template <typename Statistics> inline auto BasicRingBuffer<Statistics>::storageExtent() const noexcept -> SizeType {
+    return storage_.extent();
+}
 
-    if (bytesUsed > bytesToEnd) [[unlikely]] {
-        return {{src + readIndex, bytesToEnd}, {src, bytesUsed - bytesToEnd}};
-    }
-    return {{src + readIndex, bytesUsed}, {}};
+// MARK: - StaticRingBuffer
+
+template <std::size_t Capacity, typename Statistics>
+inline auto StaticRingBuffer<Capacity, Statistics>::storageData() const noexcept -> unsigned char * {
+    return const_cast<unsigned char *>(buffer_.data());
 }
 
-inline void RingBuffer::commitRead(SizeType count) noexcept {
-    assert(count <= availableBytes() && "Logic error: Read committing more than available data");
-    const auto readPos = readPosition_.load(std::memory_order_relaxed);
-    readPosition_.store(readPos + count, std::memory_order_release);
+template <std::size_t Capacity, typename Statistics>
+constexpr auto StaticRingBuffer<Capacity, Statistics>::storageCapacity() noexcept -> std::size_t {
+    return Capacity;
+}
+
+template <std::size_t Capacity, typename Statistics>
+constexpr auto StaticRingBuffer<Capacity, Statistics>::storageMask() noexcept -> std::size_t {
+    return Capacity - 1;
+}
+
+template <std::size_t Capacity, typename Statistics>
+constexpr auto StaticRingBuffer<Capacity, Statistics>::storageExtent() noexcept -> std::size_t {
+    return Capacity;
 }
 
 } /* namespace spsc */
@@ -0,0 +1,460 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_RING_SET_HPP
+#define SPSC_RING_SET_HPP
+
+#include "spsc/RingBuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace spsc {
+
+/// A set of ring buffers, each with its own producer, read by a single consumer that visits only the ring buffers
+/// holding data.
+///
+/// Each ring buffer is SPSC: the producer of ring buffer i writes through ``producer(i)`` and the consumer reads all
+/// of them through ``poll``. An idle ring buffer is armed in the manner of ``RingBufferBase::armReadable``; the next
+/// write through its ``Producer`` marks it in a bitmap shared by the set. ``poll`` reads one word of the bitmap for
+/// every 64 ring buffers and touches only the ring buffers that are marked, so a sweep over idle ring buffers costs a
+/// few loads rather than one cache miss per ring buffer. Each producer writes to the bitmap at most once per
+/// transition from empty to nonempty.
+class RingSet final {
+  public:
+    /// Unsigned integer type.
+    using SizeType = RingBuffer::SizeType;
+
+    /// The maximum supported number of ring buffers.
+    static constexpr auto maxRingCount = SizeType{std::numeric_limits<std::uint32_t>::max()};
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty ring set.
+    /// @note ``allocate`` must be called before the object may be used.
+    RingSet() noexcept = default;
+
+    /// Creates a ring set with the specified number of ring buffers.
+    /// @param ringCount The number of ring buffers.
+    /// @param minCapacity The desired minimum capacity of each ring buffer in bytes.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the ring count or buffer
+    /// capacity is not supported.
+    RingSet(SizeType ringCount, SizeType minCapacity);
+
+    RingSet(const RingSet &) = delete;
+    RingSet &operator=(const RingSet &) = delete;
+
+    /// Destroys the ring set and releases all associated resources.
+    ~RingSet() noexcept = default;
+
+    // MARK: Set Management
+
+    /// Allocates ring buffers, discarding any existing ring buffers.
+    ///
+    /// The actual capacity of each ring buffer will be the smallest integral power of two that is not less than the
+    /// specified minimum capacity.
+    /// @note This method is not thread safe.
+    /// @param ringCount The number of ring buffers.
+    /// @param minCapacity The desired minimum capacity of each ring buffer in bytes.
+    /// @return true on success, false if memory could not be allocated or the ring count or buffer capacity is not
+    /// supported.
+    bool allocate(SizeType ringCount, SizeType minCapacity) noexcept [[clang::allocating]];
+
+    /// Frees all ring buffers.
+    /// @note This method is not thread safe.
+    void deallocate() noexcept;
+
+    // MARK: Set Information
+
+    /// Returns true if the set has ring buffers.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of ring buffers in the set.
+    [[nodiscard]] SizeType ringCount() const noexcept [[clang::nonblocking]];
+
+    // MARK: Producing
+
+    /// The producer side of a ring buffer in the set.
+    ///
+    /// The methods match those of ``RingBufferBase``. Each method that publishes data calls
+    /// ``RingBufferBase::notifyConsumer``, which marks the ring buffer if it was armed.
+    /// @note A producer is only safe to use from the producer of its ring buffer.
+    class Producer {
+      public:
+        /// Returns the capacity of the ring buffer in bytes.
+        [[nodiscard]] SizeType capacity() const noexcept [[clang::nonblocking]];
+
+        /// Returns the amount of free space in the ring buffer in bytes.
+        [[nodiscard]] SizeType freeSpace() const noexcept [[clang::nonblocking]];
+
+        /// Writes data and advances the write position.
+        /// @return The number of items actually written.
+        SizeType write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount, bool allowPartial,
+                       CopyMode mode = CopyMode::standard) noexcept;
+
+        /// Writes items and advances the write position.
+        /// @return The number of items actually written.
+        template <ByteCopyable T>
+        SizeType write(std::span<const T> data, bool allowPartial = true, CopyMode mode = CopyMode::standard) noexcept;
+
+        /// Writes a value and advances the write position.
+        /// @return true if value was successfully written.
+        bool write(ValueLike auto const &value) noexcept;
+
+        /// Writes values and advances the write position.
+        /// @return true if the values were successfully written.
+        template <ValueLike... Args>
+            requires(sizeof...(Args) > 1)
+        bool writeAll(const Args &...args) noexcept;
+
+        /// Writes data gathered from multiple fragments and advances the write position once.
+        /// @return The number of bytes actually written.
+        SizeType writev(std::span<const std::span<const std::byte>> fragments, bool allowPartial = true) noexcept;
+
+        /// Returns a write vector containing the current writable space.
+        [[nodiscard]] RingBuffer::WriteVector writeVector() const noexcept [[clang::nonblocking]];
+
+        /// Returns a write vector containing the current writable space, which is at least count bytes if that much is
+        /// available.
+        [[nodiscard]] RingBuffer::WriteVector writeVector(SizeType count) const noexcept [[clang::nonblocking]];
+
+        /// Finalizes a write transaction by writing staged data to the ring buffer.
+        void commitWrite(SizeType count) noexcept;
+
+        /// Passes the current writable space to a function that fills it in place, then publishes what it produced.
+        /// @return The number of bytes produced.
+        /// @throw Any exceptions thrown by f, in which case nothing is committed.
+        template <typename F>
+            requires std::is_invocable_r_v<SizeType, F &, std::span<std::byte>>
+        SizeType produce(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<std::byte>>);
+
+        /// Writes data, blocking until sufficient free space is available, and advances the write position.
+        /// @return true if the items were written, false if they can never fit in the ring buffer.
+        template <typename W = ParkWait>
+            requires WaitStrategy<std::remove_cvref_t<W>>
+        bool writeWait(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                       W &&strategy = {}) noexcept [[clang::blocking]];
+
+        /// Writes a value, blocking until sufficient free space is available, and advances the write position.
+        /// @return true if value was written, false if it can never fit in the ring buffer.
+        template <typename W = ParkWait>
+            requires WaitStrategy<std::remove_cvref_t<W>>
+        bool writeWait(ValueLike auto const &value, W &&strategy = {}) noexcept [[clang::blocking]];
+
+      private:
+        friend class RingSet;
+
+        explicit Producer(RingBuffer &ring) noexcept;
+
+        /// Marks the ring buffer if written is nonzero and returns written.
+        template <typename T> T published(T written) noexcept;
+
+        /// The ring buffer.
+        RingBuffer *RB_NONNULL ring_;
+    };
+
+    /// Returns the producer side of a ring buffer in the set.
+    /// @param index The index of the ring buffer, which must be less than ``ringCount()``.
+    [[nodiscard]] Producer producer(SizeType index) noexcept [[clang::nonblocking]];
+
+    // MARK: Consuming
+
+    /// Passes the readable data of each marked ring buffer to a function that processes it in place, then removes
+    /// what it consumed.
+    ///
+    /// Marked ring buffers are visited once each in index order, beginning after the last ring buffer visited by the
+    /// previous call so that none is always visited last. The function is called as in ``RingBufferBase::consume``
+    /// with the index of the ring buffer and at most budget bytes in total, and returns the number of bytes it
+    /// consumed. A ring buffer left with data remains marked; one left empty is armed again.
+    /// @note This method is only safe to call from the consumer.
+    /// @param f The function processing data.
+    /// @param budget The maximum number of bytes offered from each ring buffer.
+    /// @return The number of bytes consumed from all ring buffers.
+    /// @throw Any exceptions thrown by f, in which case nothing is committed for the ring buffer being visited.
+    template <typename F>
+        requires std::is_invocable_r_v<SizeType, F &, SizeType, std::span<const std::byte>>
+    SizeType poll(F &&f, SizeType budget = std::numeric_limits<SizeType>::max()) noexcept(
+            std::is_nothrow_invocable_v<F &, SizeType, std::span<const std::byte>>);
+
+    /// Returns true if at least one ring buffer is marked.
+    /// @note This method is only safe to call from the consumer.
+    [[nodiscard]] bool hasMarked() const noexcept [[clang::nonblocking]];
+
+  private:
+    /// The number of ring buffers per bitmap word.
+    static constexpr auto wordBits = SizeType{64};
+
+    /// A ring buffer and the continuation that marks it.
+    struct Entry {
+        RingBuffer ring;
+        /// Published to the ring buffer while it is armed.
+        detail::Continuation continuation;
+        /// The bitmap word containing the ring buffer's bit.
+        std::atomic<std::uint64_t> *RB_NULLABLE word{nullptr};
+        /// The ring buffer's bit.
+        std::uint64_t mask{0};
+    };
+
+    /// A word of the bitmap shared by the producers, on its own cache line.
+    struct alignas(cacheLineSize) Word {
+        std::atomic<std::uint64_t> bits{0};
+    };
+
+    /// Marks the ring buffer of the entry passed as context.
+    static void mark(void *context, std::coroutine_handle<> /*coroutine*/) noexcept;
+
+    /// Processes the marked ring buffers with indexes in [begin, end).
+    template <typename F> SizeType visit(SizeType begin, SizeType end, F &f, SizeType budget);
+
+    /// The ring buffers.
+    std::unique_ptr<Entry[]> entries_;
+    /// Ring buffers marked by their producers since the consumer last collected them.
+    std::unique_ptr<Word[]> marked_;
+    /// Ring buffers collected by the consumer and not yet emptied.
+    std::unique_ptr<std::uint64_t[]> pending_;
+    /// The number of ring buffers.
+    SizeType ringCount_{0};
+    /// The index at which the next visit begins.
+    SizeType cursor_{0};
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+inline RingSet::RingSet(SizeType ringCount, SizeType minCapacity) {
+    if (ringCount == 0 || ringCount > maxRingCount || minCapacity < RingBuffer::minCapacity ||
+        minCapacity > RingBuffer::maxCapacity) [[unlikely]] {
+        throw std::invalid_argument("ring count or capacity out of range");
+    }
+    if (!allocate(ringCount, minCapacity)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
+
+// MARK: Set Management
+
+inline bool RingSet::allocate(SizeType ringCount, SizeType minCapacity) noexcept {
+    if (ringCount == 0 || ringCount > maxRingCount) [[unlikely]] {
+        return false;
+    }
+
+    deallocate();
+
+    const auto wordCount = (ringCount + wordBits - 1) / wordBits;
+    std::unique_ptr<Entry[]> entries{new (std::nothrow) Entry[ringCount]};
+    std::unique_ptr<Word[]> marked{new (std::nothrow) Word[wordCount]};
+    std::unique_ptr<std::uint64_t[]> pending{new (std::nothrow) std::uint64_t[wordCount]{}};
+    if (!entries || !marked || !pending) [[unlikely]] {
+        return false;
+    }
+
+    for (SizeType i = 0; i < ringCount; ++i) {
+        auto &entry = entries[i];
+        if (!entry.ring.allocate(minCapacity)) [[unlikely]] {
+            return false;
+        }
+        entry.continuation = {.count = 1, .schedule = mark, .scheduler = &entry};
+        entry.word = &marked[i / wordBits].bits;
+        entry.mask = std::uint64_t{1} << (i % wordBits);
+        // Every ring buffer is empty, so arming succeeds
+        entry.ring.suspend<false>(entry.continuation);
+    }
+
+    entries_ = std::move(entries);
+    marked_ = std::move(marked);
+    pending_ = std::move(pending);
+    ringCount_ = ringCount;
+
+    return true;
+}
+
+inline void RingSet::deallocate() noexcept {
+    entries_.reset();
+    marked_.reset();
+    pending_.reset();
+    ringCount_ = 0;
+    cursor_ = 0;
+}
+
+// MARK: Set Information
+
+inline RingSet::operator bool() const noexcept { return ringCount_ != 0; }
+
+inline auto RingSet::ringCount() const noexcept -> SizeType { return ringCount_; }
+
+// MARK: Producing
+
+inline RingSet::Producer::Producer(RingBuffer &ring) noexcept : ring_{&ring} {}
+
+inline auto RingSet::Producer::capacity() const noexcept -> SizeType { return ring_->capacity(); }
+
+inline auto RingSet::Producer::freeSpace() const noexcept -> SizeType { return ring_->freeSpace(); }
+
+inline auto RingSet::Producer::write(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                     bool allowPartial, CopyMode mode) noexcept -> SizeType {
+    return published(ring_->write(ptr, itemSize, itemCount, allowPartial, mode));
+}
+
+template <ByteCopyable T>
+inline auto RingSet::Producer::write(std::span<const T> data, bool allowPartial, CopyMode mode) noexcept
+        -> SizeType {
+    return published(ring_->write(data, allowPartial, mode));
+}
+
+inline bool RingSet::Producer::write(ValueLike auto const &value) noexcept { return published(ring_->write(value)); }
+
+template <ValueLike... Args>
+    requires(sizeof...(Args) > 1)
+inline bool RingSet::Producer::writeAll(const Args &...args) noexcept {
+    return published(ring_->writeAll(args...));
+}
+
+inline auto RingSet::Producer::writev(std::span<const std::span<const std::byte>> fragments,
+                                      bool allowPartial) noexcept -> SizeType {
+    return published(ring_->writev(fragments, allowPartial));
+}
+
+inline auto RingSet::Producer::writeVector() const noexcept -> RingBuffer::WriteVector {
+    return ring_->writeVector();
+}
+
+inline auto RingSet::Producer::writeVector(SizeType count) const noexcept -> RingBuffer::WriteVector {
+    return ring_->writeVector(count);
+}
+
+inline void RingSet::Producer::commitWrite(SizeType count) noexcept {
+    ring_->commitWrite(count);
+    published(count);
+}
+
+template <typename F>
+    requires std::is_invocable_r_v<RingSet::SizeType, F &, std::span<std::byte>>
+inline auto RingSet::Producer::produce(F &&f) noexcept(std::is_nothrow_invocable_v<F &, std::span<std::byte>>)
+        -> SizeType {
+    return published(ring_->produce(std::forward<F>(f)));
+}
+
+template <typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingSet::Producer::writeWait(const void *const RB_NONNULL ptr, SizeType itemSize, SizeType itemCount,
+                                         W &&strategy) noexcept {
+    // Blocking writes wake the consumer themselves
+    return ring_->writeWait(ptr, itemSize, itemCount, std::forward<W>(strategy));
+}
+
+template <typename W>
+    requires WaitStrategy<std::remove_cvref_t<W>>
+inline bool RingSet::Producer::writeWait(ValueLike auto const &value, W &&strategy) noexcept {
+    return ring_->writeWait(value, std::forward<W>(strategy));
+}
+
+template <typename T> inline T RingSet::Producer::published(T written) noexcept {
+    if (written) {
+        ring_->notifyConsumer();
+    }
+    return written;
+}
+
+inline auto RingSet::producer(SizeType index) noexcept -> Producer { return Producer{entries_[index].ring}; }
+
+// MARK: Consuming
+
+template <typename F>
+    requires std::is_invocable_r_v<RingSet::SizeType, F &, RingSet::SizeType, std::span<const std::byte>>
+inline auto RingSet::poll(F &&f, SizeType budget) noexcept(
+        std::is_nothrow_invocable_v<F &, SizeType, std::span<const std::byte>>) -> SizeType {
+    if (ringCount_ == 0) [[unlikely]] {
+        return 0;
+    }
+
+    const auto wordCount = (ringCount_ + wordBits - 1) / wordBits;
+    for (SizeType w = 0; w < wordCount; ++w) {
+        auto &bits = marked_[w].bits;
+        // Only write the shared word if a producer has marked it. Pairs with the release in mark.
+        if (bits.load(std::memory_order_relaxed) != 0) {
+            pending_[w] |= bits.exchange(0, std::memory_order_acquire);
+        }
+    }
+
+    const auto start = cursor_;
+    auto consumed = visit(start, ringCount_, f, budget);
+    consumed += visit(0, start, f, budget);
+    return consumed;
+}
+
+inline bool RingSet::hasMarked() const noexcept {
+    const auto wordCount = (ringCount_ + wordBits - 1) / wordBits;
+    for (SizeType w = 0; w < wordCount; ++w) {
+        if (pending_[w] != 0 || marked_[w].bits.load(std::memory_order_relaxed) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// MARK: Helpers
+
+inline void RingSet::mark(void *context, std::coroutine_handle<> /*coroutine*/) noexcept {
+    const auto &entry = *static_cast<const Entry *>(context);
+    entry.word->fetch_or(entry.mask, std::memory_order_release);
+}
+
+template <typename F> inline auto RingSet::visit(SizeType begin, SizeType end, F &f, SizeType budget) -> SizeType {
+    SizeType consumed = 0;
+    for (auto w = begin / wordBits; w * wordBits < end; ++w) {
+        const auto first = w * wordBits;
+        auto bits = pending_[w];
+        if (begin > first) {
+            bits &= ~std::uint64_t{0} << (begin - first);
+        }
+        if (end - first < wordBits) {
+            bits &= (std::uint64_t{1} << (end - first)) - 1;
+        }
+
+        while (bits != 0) {
+            const auto bit = static_cast<SizeType>(std::countr_zero(bits));
+            bits &= bits - 1;
+            const auto index = first + bit;
+            auto &entry = entries_[index];
+
+            auto remaining = budget;
+            consumed += entry.ring.consume([&](std::span<const std::byte> data) -> SizeType {
+                if (remaining == 0) {
+                    return 0;
+                }
+                const auto offered = data.first(std::min(data.size(), remaining));
+                const auto used = std::min<SizeType>(std::invoke(f, index, offered), offered.size());
+                remaining -= used;
+                return used;
+            });
+
+            // A ring buffer stays pending until it is found empty and armed
+            if (entry.ring.isEmpty() && entry.ring.suspend<false>(entry.continuation)) {
+                pending_[w] &= ~(std::uint64_t{1} << bit);
+            }
+            cursor_ = index + 1 < ringCount_ ? index + 1 : 0;
+        }
+    }
+    return consumed;
+}
+
+} /* namespace spsc */
+
+#endif
@@ -0,0 +1,250 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_SHARED_RING_BUFFER_HPP
+#define SPSC_SHARED_RING_BUFFER_HPP
+
+#include "spsc/RingBuffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace spsc {
+
+/// A lock-free SPSC ring buffer in memory shared between processes.
+///
+/// The ring buffer's control block and data live in a POSIX shared memory object or a file mapped by both the
+/// producer and consumer processes. The data is located relative to the control block and no method available in
+/// shared memory stores an address there, so each process may map it anywhere. Each process accesses the ring buffer
+/// through its own ``SharedRingBuffer``, which owns the mapping.
+///
+/// The usual reading and writing methods are available through ``operator->``. The blocking methods park on wait
+/// words in the shared memory, so a process blocked in ``readWait`` is woken by the producer process and one blocked
+/// in ``writeWait`` by the consumer process.
+/// @note The awaiting and event notifier methods publish process-local addresses and are unavailable.
+/// @note Shared memory is only available on Linux and Darwin.
+class SharedRingBuffer final {
+  public:
+    /// Unsigned integer type.
+    using SizeType = std::size_t;
+
+    /// Which side of the ring buffer a process uses.
+    enum class Role : std::uint8_t {
+        /// The process writes to the ring buffer.
+        producer,
+        /// The process reads from the ring buffer.
+        consumer,
+    };
+
+    class Ring;
+
+    /// Identifies shared memory containing a ring buffer.
+    static constexpr std::uint64_t magic = 0x4D48'5342'5258'5843; // "CXXRBSHM" in little-endian byte order
+    /// The version of the shared memory layout.
+    static constexpr std::uint32_t version = 1;
+
+    // MARK: Construction and Destruction
+
+    /// Creates an object that is not attached to a ring buffer.
+    SharedRingBuffer() noexcept = default;
+
+    SharedRingBuffer(const SharedRingBuffer &) = delete;
+    SharedRingBuffer &operator=(const SharedRingBuffer &) = delete;
+
+    /// Creates an object by moving another object's attachment.
+    /// @param other The object to move.
+    SharedRingBuffer(SharedRingBuffer &&other) noexcept;
+
+    /// Detaches from any ring buffer and moves another object's attachment into this object.
+    /// @param other The object to move.
+    SharedRingBuffer &operator=(SharedRingBuffer &&other) noexcept;
+
+    /// Detaches from the ring buffer.
+    ~SharedRingBuffer() noexcept;
+
+    // MARK: Attaching
+
+    /// Creates a named POSIX shared memory object containing an empty ring buffer and attaches to it.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param name The name of the shared memory object, which must begin with a slash and must not already exist.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param role The side of the ring buffer this process uses.
+    /// @return true on success, false if the object could not be created or the buffer capacity is not supported.
+    bool create(const char *const RB_NONNULL name, SizeType minCapacity, Role role) noexcept;
+
+    /// Attaches to a ring buffer in a named POSIX shared memory object.
+    /// @param name The name of the shared memory object.
+    /// @param role The side of the ring buffer this process uses.
+    /// @return true on success, false if the object could not be opened, does not contain a compatible ring buffer,
+    /// or a live process, including this one, already holds role.
+    bool open(const char *const RB_NONNULL name, Role role) noexcept;
+
+    /// Initializes an empty ring buffer in a file and attaches to it.
+    ///
+    /// The file is resized to fit the ring buffer. The file descriptor may be closed once this method returns.
+    /// @param fd A file descriptor open for reading and writing.
+    /// @param minCapacity The desired minimum capacity in bytes.
+    /// @param role The side of the ring buffer this process uses.
+    /// @return true on success, false if the file could not be resized or mapped or the buffer capacity is not
+    /// supported.
+    bool create(int fd, SizeType minCapacity, Role role) noexcept;
+
+    /// Attaches to a ring buffer in a file.
+    ///
+    /// The file descriptor may be closed once this method returns.
+    /// @param fd A file descriptor open for reading and writing.
+    /// @param role The side of the ring buffer this process uses.
+    /// @return true on success, false if the file could not be mapped, does not contain a compatible ring buffer, or
+    /// a live process, including this one, already holds role.
+    bool open(int fd, Role role) noexcept;
+
+    /// Removes the name of a POSIX shared memory object.
+    ///
+    /// Processes attached to the ring buffer are unaffected.
+    /// @param name The name of the shared memory object.
+    /// @return true on success, false otherwise.
+    static bool remove(const char *const RB_NONNULL name) noexcept;
+
+    /// Releases this process's role and unmaps the ring buffer.
+    void close() noexcept;
+
+    // MARK: Ring Buffer Access
+
+    /// Returns true if this object is attached to a ring buffer.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    /// Returns the side of the ring buffer this process uses.
+    [[nodiscard]] Role role() const noexcept [[clang::nonblocking]];
+
+    /// Returns the attached ring buffer.
+    /// @warning The behavior is undefined if this object is not attached to a ring buffer.
+    [[nodiscard]] Ring &operator*() const noexcept [[clang::nonblocking]];
+
+    /// Returns the attached ring buffer.
+    /// @warning The behavior is undefined if this object is not attached to a ring buffer.
+    [[nodiscard]] Ring *RB_NONNULL operator->() const noexcept [[clang::nonblocking]];
+
+    // MARK: Peer Status
+
+    /// Returns true if a live process holds the other role.
+    ///
+    /// A process that exits or crashes without calling ``close()`` is detected as dead. If a peer dies another
+    /// process may open the ring buffer in its role and continue from where it stopped.
+    /// @note Processes are identified by process ID, which the system may eventually reuse.
+    [[nodiscard]] bool isPeerAlive() const noexcept;
+
+  private:
+    /// Maps a ring buffer from fd, initializing it if minCapacity is nonzero.
+    bool attach(int fd, SizeType minCapacity, Role role) noexcept;
+
+    /// The mapped ring buffer.
+    Ring *RB_NULLABLE ring_{nullptr};
+    /// The size of the mapping in bytes.
+    SizeType mappingSize_{0};
+    /// The side of the ring buffer this process uses.
+    Role role_{Role::producer};
+};
+
+template <> struct RingBufferTraits<SharedRingBuffer::Ring> {
+    using Statistics = NoStatistics;
+    static constexpr bool processShared = true;
+};
+
+/// The part of a shared ring buffer that lives in shared memory.
+///
+/// The control block is immediately followed by the data, which is located relative to the control block's address.
+class SharedRingBuffer::Ring final : public RingBufferBase<Ring> {
+  public:
+    Ring(const Ring &) = delete;
+    Ring &operator=(const Ring &) = delete;
+
+  private:
+    friend RingBufferBase<Ring>;
+    friend SharedRingBuffer;
+
+    /// Creates the control block for a ring buffer of the specified capacity.
+    explicit Ring(SizeType capacity) noexcept;
+
+    /// Identifies initialized shared memory once set to ``SharedRingBuffer::magic``.
+    std::atomic<std::uint64_t> magic_{0};
+    /// The version of the shared memory layout.
+    std::uint32_t version_{SharedRingBuffer::version};
+    /// The size of the control block, which differs if the two processes disagree about its layout.
+    std::uint32_t controlSize_{0};
+    /// The capacity of the data in bytes.
+    SizeType capacity_{0};
+    /// The capacity of the data in bytes minus one.
+    SizeType capacityMask_{0};
+
+    /// The process ID of the producer, or zero if there is none.
+    alignas(cacheLineSize) std::atomic<std::int64_t> producer_{0};
+    /// The process ID of the consumer, or zero if there is none.
+    alignas(cacheLineSize) std::atomic<std::int64_t> consumer_{0};
+
+    [[nodiscard]] unsigned char *RB_NONNULL storageData() const noexcept [[clang::nonblocking]];
+    [[nodiscard]] SizeType storageCapacity() const noexcept [[clang::nonblocking]];
+    [[nodiscard]] SizeType storageMask() const noexcept [[clang::nonblocking]];
+    [[nodiscard]] SizeType storageExtent() const noexcept [[clang::nonblocking]];
+
+    /// Returns the slot holding the process ID for role.
+    [[nodiscard]] std::atomic<std::int64_t> &holder(Role role) noexcept [[clang::nonblocking]];
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free && std::atomic<std::int64_t>::is_always_lock_free,
+                  "Lock-free 64-bit atomics are required in shared memory");
+};
+
+// MARK: - Implementation -
+
+inline SharedRingBuffer::SharedRingBuffer(SharedRingBuffer &&other) noexcept
+    : ring_{std::exchange(other.ring_, nullptr)}, mappingSize_{std::exchange(other.mappingSize_, 0)},
+      role_{other.role_} {}
+
+inline auto SharedRingBuffer::operator=(SharedRingBuffer &&other) noexcept -> SharedRingBuffer & {
+    if (this != &other) [[likely]] {
+        close();
+        ring_ = std::exchange(other.ring_, nullptr);
+        mappingSize_ = std::exchange(other.mappingSize_, 0);
+        role_ = other.role_;
+    }
+    return *this;
+}
+
+inline SharedRingBuffer::~SharedRingBuffer() noexcept { close(); }
+
+inline SharedRingBuffer::operator bool() const noexcept { return ring_ != nullptr; }
+
+inline auto SharedRingBuffer::role() const noexcept -> Role { return role_; }
+
+inline auto SharedRingBuffer::operator*() const noexcept -> Ring & { return *ring_; }
+
+inline auto SharedRingBuffer::operator->() const noexcept -> Ring * { return ring_; }
+
+inline SharedRingBuffer::Ring::Ring(SizeType capacity) noexcept
+    : controlSize_{static_cast<std::uint32_t>(sizeof(Ring))}, capacity_{capacity}, capacityMask_{capacity - 1} {}
+
+inline auto SharedRingBuffer::Ring::storageData() const noexcept -> unsigned char * {
+    // The data follows the control block, whose size is a multiple of the cache line size
+    return reinterpret_cast<unsigned char *>(const_cast<Ring *>(this)) + sizeof(Ring);
+}
+
+inline auto SharedRingBuffer::Ring::storageCapacity() const noexcept -> SizeType { return capacity_; }
+
+inline auto SharedRingBuffer::Ring::storageMask() const noexcept -> SizeType { return capacityMask_; }
+
+inline auto SharedRingBuffer::Ring::storageExtent() const noexcept -> SizeType { return capacity_; }
+
+inline auto SharedRingBuffer::Ring::holder(Role role) noexcept -> std::atomic<std::int64_t> & {
+    return role == Role::producer ? producer_ : consumer_;
+}
+
+} /* namespace spsc */
+
+#endif
@@ -0,0 +1,209 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_STATISTICS_HPP
+#define SPSC_STATISTICS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace spsc {
+
+// MARK: Snapshots
+
+/// A snapshot of the usage counters of a ring buffer.
+struct RingBufferStatistics {
+    /// The largest number of bytes in use observed by either side.
+    ///
+    /// Occupancy is sampled each time the producer or consumer reloads the other side's position, which happens at
+    /// least once per pass through the buffer and always before a write is refused for lack of space.
+    std::uint64_t highWaterMark{0};
+    /// The total number of bytes written.
+    std::uint64_t bytesWritten{0};
+    /// The total number of bytes read or discarded.
+    std::uint64_t bytesRead{0};
+    /// The number of writes that were refused or truncated for lack of free space.
+    std::uint64_t fullWrites{0};
+    /// The number of reads that were refused or truncated for lack of data.
+    std::uint64_t emptyReads{0};
+    /// The number of writes that crossed the end of the buffer.
+    std::uint64_t wraps{0};
+
+    /// The number of residence time samples taken.
+    std::uint64_t residenceSamples{0};
+    /// The number of residence time samples dropped because too many were outstanding.
+    std::uint64_t residenceSamplesDropped{0};
+    /// Residence time samples by magnitude.
+    ///
+    /// Element 0 counts samples of zero nanoseconds and element i counts samples of at least 2^(i-1) and less than
+    /// 2^i nanoseconds. The last element also counts all longer samples.
+    std::array<std::uint64_t, 48> residenceHistogram{};
+};
+
+// MARK: Statistics Policies
+
+namespace detail {
+
+/// Adds n to a counter modified only by the calling thread.
+inline void increment(std::atomic<std::uint64_t> &counter, std::uint64_t n = 1) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+/// Raises a counter modified only by the calling thread to value if it is lower.
+inline void raise(std::atomic<std::uint64_t> &counter, std::uint64_t value) noexcept {
+    if (value > counter.load(std::memory_order_relaxed)) {
+        counter.store(value, std::memory_order_relaxed);
+    }
+}
+
+/// Moves the value of other into counter and resets other to zero.
+inline void take(std::atomic<std::uint64_t> &counter, std::atomic<std::uint64_t> &other) noexcept {
+    counter.store(other.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+} /* namespace detail */
+
+/// A statistics policy provides the counters a ring buffer maintains on each side.
+///
+/// ``Producer`` is modified by the producer and ``Consumer`` by the consumer; each is stored on its owner's cache line.
+/// ``recordWrite`` receives the write position before the data was written and ``recordRead`` the read position before
+/// the data was read, along with the producer's counters so that the consumer may inspect state published by the
+/// producer. ``recordWrite`` is called before the release store of the write position, so anything it publishes is
+/// visible to a consumer that has read the data. ``collect`` may be called from any thread.
+template <typename S>
+concept StatisticsPolicy =
+        std::default_initializable<typename S::Producer> && std::default_initializable<typename S::Consumer> &&
+        requires(typename S::Producer &p, typename S::Consumer &c, const typename S::Producer &cp,
+                 const typename S::Consumer &cc, std::size_t n, bool b, RingBufferStatistics &snapshot) {
+            { p.recordWrite(n, n, b) } noexcept;
+            { p.recordFull() } noexcept;
+            { p.recordOccupancy(n) } noexcept;
+            { p.reset() } noexcept;
+            { p.take(p) } noexcept;
+            { cp.collect(snapshot) } noexcept;
+            { c.recordRead(n, n, p) } noexcept;
+            { c.recordEmpty() } noexcept;
+            { c.recordOccupancy(n) } noexcept;
+            { c.reset() } noexcept;
+            { c.take(c) } noexcept;
+            { cc.collect(snapshot) } noexcept;
+        };
+
+/// Maintains no counters.
+///
+/// Every operation is empty, so a ring buffer using this policy is identical in size and speed to one without
+/// statistics.
+struct NoStatistics {
+    struct Producer {
+        constexpr void recordWrite(std::size_t /*writePos*/, std::size_t /*count*/, bool /*wrapped*/) noexcept {}
+        constexpr void recordFull() noexcept {}
+        constexpr void recordOccupancy(std::size_t /*bytesUsed*/) noexcept {}
+        constexpr void reset() noexcept {}
+        constexpr void take(Producer & /*other*/) noexcept {}
+        constexpr void collect(RingBufferStatistics & /*snapshot*/) const noexcept {}
+    };
+
+    struct Consumer {
+        constexpr void recordRead(std::size_t /*readPos*/, std::size_t /*count*/, Producer & /*producer*/) noexcept {}
+        constexpr void recordEmpty() noexcept {}
+        constexpr void recordOccupancy(std::size_t /*bytesUsed*/) noexcept {}
+        constexpr void reset() noexcept {}
+        constexpr void take(Consumer & /*other*/) noexcept {}
+        constexpr void collect(RingBufferStatistics & /*snapshot*/) const noexcept {}
+    };
+};
+
+/// Maintains the counters of ``RingBufferStatistics``.
+///
+/// Each counter has a single writer, so it is updated with a relaxed load and store rather than a read-modify-write,
+/// and may be read from any thread.
+struct CountingStatistics {
+    class Producer {
+      public:
+        void recordWrite(std::size_t /*writePos*/, std::size_t count, bool wrapped) noexcept {
+            detail::increment(bytesWritten_, count);
+            if (wrapped) {
+                detail::increment(wraps_);
+            }
+        }
+
+        void recordFull() noexcept { detail::increment(fullWrites_); }
+
+        void recordOccupancy(std::size_t bytesUsed) noexcept { detail::raise(highWaterMark_, bytesUsed); }
+
+        void reset() noexcept {
+            highWaterMark_.store(0, std::memory_order_relaxed);
+            bytesWritten_.store(0, std::memory_order_relaxed);
+            fullWrites_.store(0, std::memory_order_relaxed);
+            wraps_.store(0, std::memory_order_relaxed);
+        }
+
+        void take(Producer &other) noexcept {
+            detail::take(highWaterMark_, other.highWaterMark_);
+            detail::take(bytesWritten_, other.bytesWritten_);
+            detail::take(fullWrites_, other.fullWrites_);
+            detail::take(wraps_, other.wraps_);
+        }
+
+        void collect(RingBufferStatistics &snapshot) const noexcept {
+            snapshot.highWaterMark = std::max(snapshot.highWaterMark, highWaterMark_.load(std::memory_order_relaxed));
+            snapshot.bytesWritten = bytesWritten_.load(std::memory_order_relaxed);
+            snapshot.fullWrites = fullWrites_.load(std::memory_order_relaxed);
+            snapshot.wraps = wraps_.load(std::memory_order_relaxed);
+        }
+
+      private:
+        std::atomic<std::uint64_t> highWaterMark_{0};
+        std::atomic<std::uint64_t> bytesWritten_{0};
+        std::atomic<std::uint64_t> fullWrites_{0};
+        std::atomic<std::uint64_t> wraps_{0};
+    };
+
+    class Consumer {
+      public:
+        void recordRead(std::size_t /*readPos*/, std::size_t count, Producer & /*producer*/) noexcept {
+            detail::increment(bytesRead_, count);
+        }
+
+        void recordEmpty() noexcept { detail::increment(emptyReads_); }
+
+        void recordOccupancy(std::size_t bytesUsed) noexcept { detail::raise(highWaterMark_, bytesUsed); }
+
+        void reset() noexcept {
+            highWaterMark_.store(0, std::memory_order_relaxed);
+            bytesRead_.store(0, std::memory_order_relaxed);
+            emptyReads_.store(0, std::memory_order_relaxed);
+        }
+
+        void take(Consumer &other) noexcept {
+            detail::take(highWaterMark_, other.highWaterMark_);
+            detail::take(bytesRead_, other.bytesRead_);
+            detail::take(emptyReads_, other.emptyReads_);
+        }
+
+        void collect(RingBufferStatistics &snapshot) const noexcept {
+            snapshot.highWaterMark = std::max(snapshot.highWaterMark, highWaterMark_.load(std::memory_order_relaxed));
+            snapshot.bytesRead = bytesRead_.load(std::memory_order_relaxed);
+            snapshot.emptyReads = emptyReads_.load(std::memory_order_relaxed);
+        }
+
+      private:
+        std::atomic<std::uint64_t> highWaterMark_{0};
+        std::atomic<std::uint64_t> bytesRead_{0};
+        std::atomic<std::uint64_t> emptyReads_{0};
+    };
+};
+
+static_assert(StatisticsPolicy<NoStatistics> && StatisticsPolicy<CountingStatistics>);
+
+} /* namespace spsc */
+
+#endif
@@ -0,0 +1,673 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_TYPED_RING_BUFFER_HPP
+#define SPSC_TYPED_RING_BUFFER_HPP
+
+#include "spsc/RingBuffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace spsc {
+
+template <typename T>
+concept Element = std::is_object_v<T> && !std::is_const_v<T> && !std::is_array_v<T> && std::destructible<T>;
+
+namespace detail {
+
+/// Inline, suitably aligned storage for N elements of type T.
+template <typename T, std::size_t N> struct InlineElementStorage {
+    alignas(std::max(alignof(T), cacheLineSize)) unsigned char bytes[N * sizeof(T)];
+};
+
+/// Heap storage for elements of type T.
+struct HeapElementStorage {
+    /// The memory buffer holding the elements.
+    void *RB_NULLABLE bytes{nullptr};
+    /// The capacity of bytes in elements.
+    std::size_t capacity{0};
+};
+
+} /* namespace detail */
+
+/// A lock-free SPSC ring buffer of elements of type T.
+///
+/// This class is thread safe when used with a single producer and a single consumer.
+///
+/// Unlike ``RingBuffer`` elements are constructed in place and destroyed when read, so T may be a move-only or
+/// otherwise non-trivially-copyable type. The index protocol is the same: free-running positions, counted in elements,
+/// that are owned by one side each and kept on separate cache lines.
+/// @tparam T The element type.
+/// @tparam Capacity The capacity of the ring buffer in elements, an integral power of two, or std::dynamic_extent if
+/// the capacity is chosen at runtime.
+template <Element T, std::size_t Capacity = std::dynamic_extent> class TypedRingBuffer final {
+  public:
+    /// The element type.
+    using ValueType = T;
+    /// Unsigned integer type.
+    using SizeType = std::size_t;
+    /// Atomic unsigned integer type.
+    using AtomicSizeType = std::atomic<SizeType>;
+
+    /// Whether the capacity of the ring buffer is fixed at compile time.
+    static constexpr bool hasStaticCapacity = Capacity != std::dynamic_extent;
+
+    /// The minimum supported ring buffer capacity in elements.
+    static constexpr auto minCapacity = SizeType{2};
+    /// The maximum supported ring buffer capacity in elements.
+    static constexpr auto maxCapacity = std::min(std::bit_floor(std::numeric_limits<SizeType>::max() / sizeof(T)),
+                                                 SizeType{1} << (std::numeric_limits<SizeType>::digits - 1));
+
+    static_assert(!hasStaticCapacity || (Capacity >= minCapacity && Capacity <= maxCapacity),
+                  "Capacity out of range");
+    static_assert(!hasStaticCapacity || std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+    // MARK: Construction and Destruction
+
+    /// Creates an empty ring buffer.
+    /// @note If the capacity is not static ``allocate`` must be called before the object may be used.
+    TypedRingBuffer() noexcept = default;
+
+    /// Creates a ring buffer with the specified minimum capacity.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @param minCapacity The desired minimum capacity in elements.
+    /// @throw std::bad_alloc if memory could not be allocated or std::invalid_argument if the buffer capacity is not
+    /// supported.
+    explicit TypedRingBuffer(SizeType minCapacity)
+        requires(!hasStaticCapacity);
+
+    TypedRingBuffer(const TypedRingBuffer &) = delete;
+    TypedRingBuffer &operator=(const TypedRingBuffer &) = delete;
+
+    /// Creates a ring buffer by moving the contents of another ring buffer.
+    /// @note This method is not thread safe for the ring buffer being moved.
+    /// @param other The ring buffer to move.
+    TypedRingBuffer(TypedRingBuffer &&other) noexcept
+        requires(!hasStaticCapacity);
+
+    /// Moves the contents of another ring buffer into this ring buffer.
+    /// @note This method is not thread safe.
+    /// @param other The ring buffer to move.
+    TypedRingBuffer &operator=(TypedRingBuffer &&other) noexcept
+        requires(!hasStaticCapacity);
+
+    /// Destroys any elements remaining in the ring buffer and releases all associated resources.
+    ~TypedRingBuffer() noexcept;
+
+    // MARK: Buffer Management
+
+    /// Destroys any elements in the ring buffer and allocates space for elements.
+    ///
+    /// The actual ring buffer capacity will be the smallest integral power of two that is not less than the specified
+    /// minimum capacity.
+    /// @note This method is not thread safe.
+    /// @param minCapacity The desired minimum capacity in elements.
+    /// @return true on success, false if memory could not be allocated or the buffer capacity is not supported.
+    bool allocate(SizeType minCapacity) noexcept [[clang::allocating]]
+        requires(!hasStaticCapacity);
+
+    /// Destroys any elements in the ring buffer and frees any space allocated for elements.
+    /// @note This method is not thread safe.
+    void deallocate() noexcept
+        requires(!hasStaticCapacity);
+
+    /// Returns true if the ring buffer has space for elements.
+    [[nodiscard]] explicit operator bool() const noexcept [[clang::nonblocking]];
+
+    // MARK: Buffer Information
+
+    /// Returns the capacity of the ring buffer.
+    /// @note This method is safe to call from both producer and consumer.
+    /// @return The ring buffer capacity in elements.
+    [[nodiscard]] SizeType capacity() const noexcept [[clang::nonblocking]];
+
+    // MARK: Buffer Usage
+
+    /// Returns the amount of free space in the ring buffer.
+    /// @note The result of this method is only accurate when called from the producer.
+    /// @return The number of elements that may be written.
+    [[nodiscard]] SizeType freeSpace() const noexcept [[clang::nonblocking]];
+
+    /// Returns true if the ring buffer is full.
+    /// @note The result of this method is only accurate when called from the producer.
+    /// @return true if the buffer is full.
+    [[nodiscard]] bool isFull() const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of elements in the ring buffer.
+    /// @note The result of this method is only accurate when called from the consumer.
+    /// @return The number of elements available for reading.
+    [[nodiscard]] SizeType size() const noexcept [[clang::nonblocking]];
+
+    /// Returns true if the ring buffer is empty.
+    /// @note The result of this method is only accurate when called from the consumer.
+    /// @return true if the buffer contains no elements.
+    [[nodiscard]] bool isEmpty() const noexcept [[clang::nonblocking]];
+
+    // MARK: Writing
+
+    /// Constructs an element in place and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @param args The arguments to forward to the constructor of T.
+    /// @return true if the element was constructed, false if the buffer is full.
+    /// @throw Any exceptions thrown by the selected constructor of T, in which case the write position is unchanged.
+    template <typename... Args>
+        requires std::constructible_from<T, Args...>
+    bool emplace(Args &&...args) noexcept(std::is_nothrow_constructible_v<T, Args...>);
+
+    /// Copies an element and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @param value The element to copy.
+    /// @return true if the element was written, false if the buffer is full.
+    /// @throw Any exceptions thrown by the copy constructor of T, in which case the write position is unchanged.
+    bool write(const T &value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        requires std::copy_constructible<T>;
+
+    /// Moves an element and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @note value is only moved from if the element was written.
+    /// @param value The element to move.
+    /// @return true if the element was written, false if the buffer is full.
+    /// @throw Any exceptions thrown by the move constructor of T, in which case the write position is unchanged.
+    bool write(T &&value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires std::move_constructible<T>;
+
+    /// Copies elements and advances the write position.
+    /// @note This method is only safe to call from the producer.
+    /// @param items A span containing the elements to copy.
+    /// @param allowPartial Whether any elements should be written if insufficient free space is available to write all
+    /// elements.
+    /// @return The number of elements actually written.
+    /// @throw Any exceptions thrown by the copy constructor of T, in which case the write position is unchanged.
+    SizeType write(std::span<const T> items, bool allowPartial = true) noexcept(
+            std::is_nothrow_copy_constructible_v<T>)
+        requires std::copy_constructible<T>;
+
+    // MARK: Reading
+
+    /// Moves the oldest element into value, destroys it, and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @param value The destination element.
+    /// @return true on success, false if the buffer is empty.
+    /// @throw Any exceptions thrown by the move assignment operator of T, in which case the read position is unchanged.
+    bool read(T &value) noexcept(std::is_nothrow_move_assignable_v<T>)
+        requires std::is_move_assignable_v<T>;
+
+    /// Moves the oldest element out of the ring buffer, destroys it, and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @return A std::optional containing the element if the buffer was not empty.
+    /// @throw Any exceptions thrown by the move constructor of T, in which case the read position is unchanged.
+    std::optional<T> read() noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires std::move_constructible<T>;
+
+    /// Moves elements out of the ring buffer, destroys them, and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @param buffer A span to receive the elements.
+    /// @param allowPartial Whether any elements should be read if the number of elements available to read is less than
+    /// buffer.size().
+    /// @return The number of elements actually read.
+    /// @throw Any exceptions thrown by the move assignment operator of T, in which case the read position is unchanged.
+    SizeType read(std::span<T> buffer, bool allowPartial = true) noexcept(std::is_nothrow_move_assignable_v<T>)
+        requires std::is_move_assignable_v<T>;
+
+    // MARK: Peeking
+
+    /// Returns the oldest element without advancing the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @note The element remains valid until the read position is advanced.
+    /// @return A pointer to the oldest element, or nullptr if the buffer is empty.
+    [[nodiscard]] T *RB_NULLABLE front() noexcept [[clang::nonblocking]];
+
+    /// Returns the oldest element without advancing the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @note The element remains valid until the read position is advanced.
+    /// @return A pointer to the oldest element, or nullptr if the buffer is empty.
+    [[nodiscard]] const T *RB_NULLABLE front() const noexcept [[clang::nonblocking]];
+
+    // MARK: Discarding Elements
+
+    /// Destroys elements and advances the read position.
+    /// @note This method is only safe to call from the consumer.
+    /// @param count The desired number of elements to skip.
+    /// @param allowPartial Whether any elements should be skipped if the number of elements available is less than
+    /// count.
+    /// @return The number of elements actually skipped.
+    SizeType skip(SizeType count = 1, bool allowPartial = true) noexcept [[clang::nonblocking]];
+
+    /// Destroys all elements and advances the read position to the write position, emptying the buffer.
+    /// @note This method is only safe to call from the consumer.
+    /// @return The number of elements discarded.
+    SizeType drain() noexcept [[clang::nonblocking]];
+
+  private:
+    using Storage = std::conditional_t<hasStaticCapacity, detail::InlineElementStorage<T, Capacity>,
+                                       detail::HeapElementStorage>;
+
+    /// The storage holding the elements.
+    alignas(cacheLineSize) Storage storage_;
+
+    /// The free-running write location in elements.
+    alignas(cacheLineSize) AtomicSizeType writePosition_{0};
+    /// The producer's most recently observed read location.
+    mutable SizeType cachedReadPosition_{0};
+
+    /// The free-running read location in elements.
+    alignas(cacheLineSize) AtomicSizeType readPosition_{0};
+    /// The consumer's most recently observed write location.
+    mutable SizeType cachedWritePosition_{0};
+
+    static_assert(AtomicSizeType::is_always_lock_free, "Lock-free AtomicSizeType required");
+
+    /// Returns the address of the slot for the element at position.
+    [[nodiscard]] T *slot(SizeType position) const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of elements that may be written, reloading the read position only if the cached read position
+    /// indicates that fewer than count elements are free.
+    [[nodiscard]] SizeType writableElements(SizeType writePos, SizeType count) const noexcept [[clang::nonblocking]];
+
+    /// Returns the number of elements that may be read, reloading the write position only if the cached write position
+    /// indicates that fewer than count elements are available.
+    [[nodiscard]] SizeType readableElements(SizeType readPos, SizeType count) const noexcept [[clang::nonblocking]];
+
+    /// Destroys the elements in the range [first, last).
+    void destroy(SizeType first, SizeType last) noexcept [[clang::nonblocking]];
+};
+
+// MARK: - Implementation -
+
+// MARK: Construction and Destruction
+
+template <Element T, std::size_t Capacity>
+inline TypedRingBuffer<T, Capacity>::TypedRingBuffer(SizeType minCapacity)
+    requires(!hasStaticCapacity)
+{
+    if (minCapacity < TypedRingBuffer::minCapacity || minCapacity > TypedRingBuffer::maxCapacity) [[unlikely]] {
+        throw std::invalid_argument("capacity out of range");
+    }
+    if (!allocate(minCapacity)) [[unlikely]] {
+        throw std::bad_alloc();
+    }
+}
+
+template <Element T, std::size_t Capacity>
+inline TypedRingBuffer<T, Capacity>::TypedRingBuffer(TypedRingBuffer &&other) noexcept
+    requires(!hasStaticCapacity)
+    : storage_{std::exchange(other.storage_, {})},
+      writePosition_{other.writePosition_.exchange(0, std::memory_order_relaxed)},
+      cachedReadPosition_{std::exchange(other.cachedReadPosition_, 0)},
+      readPosition_{other.readPosition_.exchange(0, std::memory_order_relaxed)},
+      cachedWritePosition_{std::exchange(other.cachedWritePosition_, 0)} {}
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::operator=(TypedRingBuffer &&other) noexcept -> TypedRingBuffer &
+    requires(!hasStaticCapacity)
+{
+    if (this != &other) [[likely]] {
+        deallocate();
+
+        storage_ = std::exchange(other.storage_, {});
+
+        writePosition_.store(other.writePosition_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        cachedReadPosition_ = std::exchange(other.cachedReadPosition_, 0);
+        readPosition_.store(other.readPosition_.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        cachedWritePosition_ = std::exchange(other.cachedWritePosition_, 0);
+    }
+    return *this;
+}
+
+template <Element T, std::size_t Capacity> inline TypedRingBuffer<T, Capacity>::~TypedRingBuffer() noexcept {
+    if constexpr (hasStaticCapacity) {
+        destroy(readPosition_.load(std::memory_order_relaxed), writePosition_.load(std::memory_order_relaxed));
+    } else {
+        deallocate();
+    }
+}
+
+// MARK: Buffer Management
+
+template <Element T, std::size_t Capacity>
+inline bool TypedRingBuffer<T, Capacity>::allocate(SizeType minCapacity) noexcept
+    requires(!hasStaticCapacity)
+{
+    if (minCapacity < TypedRingBuffer::minCapacity || minCapacity > TypedRingBuffer::maxCapacity) [[unlikely]] {
+        return false;
+    }
+
+    deallocate();
+
+    const auto capacity = std::bit_ceil(minCapacity);
+    storage_.bytes = ::operator new(capacity * sizeof(T), std::align_val_t{alignof(T)}, std::nothrow);
+
+    if (storage_.bytes == nullptr) [[unlikely]] {
+        return false;
+    }
+
+    storage_.capacity = capacity;
+
+    return true;
+}
+
+template <Element T, std::size_t Capacity>
+inline void TypedRingBuffer<T, Capacity>::deallocate() noexcept
+    requires(!hasStaticCapacity)
+{
+    if (storage_.bytes != nullptr) [[likely]] {
+        destroy(readPosition_.load(std::memory_order_relaxed), writePosition_.load(std::memory_order_relaxed));
+        ::operator delete(storage_.bytes, std::align_val_t{alignof(T)});
+
+        storage_ = {};
+
+        writePosition_.store(0, std::memory_order_relaxed);
+        cachedReadPosition_ = 0;
+        readPosition_.store(0, std::memory_order_relaxed);
+        cachedWritePosition_ = 0;
+    }
+}
+
+template <Element T, std::size_t Capacity> inline TypedRingBuffer<T, Capacity>::operator bool() const noexcept {
+    if constexpr (hasStaticCapacity) {
+        return true;
+    } else {
+        return storage_.bytes != nullptr;
+    }
+}
+
+// MARK: Buffer Information
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::capacity() const noexcept -> SizeType {
+    if constexpr (hasStaticCapacity) {
+        return Capacity;
+    } else {
+        return storage_.capacity;
+    }
+}
+
+// MARK: Buffer Usage
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::freeSpace() const noexcept -> SizeType {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto readPos = readPosition_.load(std::memory_order_acquire);
+    return capacity() - (writePos - readPos);
+}
+
+template <Element T, std::size_t Capacity> inline bool TypedRingBuffer<T, Capacity>::isFull() const noexcept {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto readPos = readPosition_.load(std::memory_order_acquire);
+    return (writePos - readPos) == capacity();
+}
+
+template <Element T, std::size_t Capacity> inline auto TypedRingBuffer<T, Capacity>::size() const noexcept -> SizeType {
+    const auto writePos = writePosition_.load(std::memory_order_acquire);
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    return writePos - readPos;
+}
+
+template <Element T, std::size_t Capacity> inline bool TypedRingBuffer<T, Capacity>::isEmpty() const noexcept {
+    const auto writePos = writePosition_.load(std::memory_order_acquire);
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    return writePos == readPos;
+}
+
+// MARK: Writing
+
+template <Element T, std::size_t Capacity>
+template <typename... Args>
+    requires std::constructible_from<T, Args...>
+inline bool
+TypedRingBuffer<T, Capacity>::emplace(Args &&...args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    if (writableElements(writePos, 1) == 0) {
+        return false;
+    }
+
+    std::construct_at(slot(writePos), std::forward<Args>(args)...);
+    writePosition_.store(writePos + 1, std::memory_order_release);
+    return true;
+}
+
+template <Element T, std::size_t Capacity>
+inline bool TypedRingBuffer<T, Capacity>::write(const T &value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+    requires std::copy_constructible<T>
+{
+    return emplace(value);
+}
+
+template <Element T, std::size_t Capacity>
+inline bool TypedRingBuffer<T, Capacity>::write(T &&value) noexcept(std::is_nothrow_move_constructible_v<T>)
+    requires std::move_constructible<T>
+{
+    return emplace(std::move(value));
+}
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::write(std::span<const T> items, bool allowPartial) noexcept(
+        std::is_nothrow_copy_constructible_v<T>) -> SizeType
+    requires std::copy_constructible<T>
+{
+    if (items.empty() || !*this) [[unlikely]] {
+        return 0;
+    }
+
+    const auto writePos = writePosition_.load(std::memory_order_relaxed);
+    const auto itemsFree = writableElements(writePos, items.size());
+
+    if (itemsFree == 0 || (itemsFree < items.size() && !allowPartial)) {
+        return 0;
+    }
+
+    const auto itemsToWrite = std::min(itemsFree, items.size());
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        const auto writeIndex = writePos & (capacity() - 1);
+        const auto itemsToEnd = capacity() - writeIndex;
+
+        if (itemsToWrite <= itemsToEnd) [[likely]] {
+            std::memcpy(slot(writePos), items.data(), itemsToWrite * sizeof(T));
+        } else [[unlikely]] {
+            std::memcpy(slot(writePos), items.data(), itemsToEnd * sizeof(T));
+            std::memcpy(slot(0), items.data() + itemsToEnd, (itemsToWrite - itemsToEnd) * sizeof(T));
+        }
+    } else {
+        SizeType constructed = 0;
+        try {
+            for (; constructed < itemsToWrite; ++constructed) {
+                std::construct_at(slot(writePos + constructed), items[constructed]);
+            }
+        } catch (...) {
+            destroy(writePos, writePos + constructed);
+            throw;
+        }
+    }
+
+    writePosition_.store(writePos + itemsToWrite, std::memory_order_release);
+    return itemsToWrite;
+}
+
+// MARK: Reading
+
+template <Element T, std::size_t Capacity>
+inline bool TypedRingBuffer<T, Capacity>::read(T &value) noexcept(std::is_nothrow_move_assignable_v<T>)
+    requires std::is_move_assignable_v<T>
+{
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    if (readableElements(readPos, 1) == 0) {
+        return false;
+    }
+
+    auto *element = slot(readPos);
+    value = std::move(*element);
+    std::destroy_at(element);
+    readPosition_.store(readPos + 1, std::memory_order_release);
+    return true;
+}
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::read() noexcept(std::is_nothrow_move_constructible_v<T>) -> std::optional<T>
+    requires std::move_constructible<T>
+{
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    if (readableElements(readPos, 1) == 0) {
+        return std::nullopt;
+    }
+
+    auto *element = slot(readPos);
+    std::optional<T> result{std::move(*element)};
+    std::destroy_at(element);
+    readPosition_.store(readPos + 1, std::memory_order_release);
+    return result;
+}
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::read(std::span<T> buffer, bool allowPartial) noexcept(
+        std::is_nothrow_move_assignable_v<T>) -> SizeType
+    requires std::is_move_assignable_v<T>
+{
+    if (buffer.empty() || !*this) [[unlikely]] {
+        return 0;
+    }
+
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    const auto itemsAvailable = readableElements(readPos, buffer.size());
+
+    if (itemsAvailable == 0 || (itemsAvailable < buffer.size() && !allowPartial)) {
+        return 0;
+    }
+
+    const auto itemsToRead = std::min(itemsAvailable, buffer.size());
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        const auto readIndex = readPos & (capacity() - 1);
+        const auto itemsToEnd = capacity() - readIndex;
+
+        if (itemsToRead <= itemsToEnd) [[likely]] {
+            std::memcpy(buffer.data(), slot(readPos), itemsToRead * sizeof(T));
+        } else [[unlikely]] {
+            std::memcpy(buffer.data(), slot(readPos), itemsToEnd * sizeof(T));
+            std::memcpy(buffer.data() + itemsToEnd, slot(0), (itemsToRead - itemsToEnd) * sizeof(T));
+        }
+    } else {
+        for (SizeType i = 0; i < itemsToRead; ++i) {
+            buffer[i] = std::move(*slot(readPos + i));
+        }
+        destroy(readPos, readPos + itemsToRead);
+    }
+
+    readPosition_.store(readPos + itemsToRead, std::memory_order_release);
+    return itemsToRead;
+}
+
+// MARK: Peeking
+
+template <Element T, std::size_t Capacity> inline auto TypedRingBuffer<T, Capacity>::front() noexcept -> T * {
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    if (readableElements(readPos, 1) == 0) {
+        return nullptr;
+    }
+    return slot(readPos);
+}
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::front() const noexcept -> const T * {
+    return const_cast<TypedRingBuffer *>(this)->front();
+}
+
+// MARK: Discarding Elements
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::skip(SizeType count, bool allowPartial) noexcept -> SizeType {
+    if (count == 0 || !*this) [[unlikely]] {
+        return 0;
+    }
+
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    const auto itemsAvailable = readableElements(readPos, count);
+
+    if (itemsAvailable == 0 || (itemsAvailable < count && !allowPartial)) {
+        return 0;
+    }
+
+    const auto itemsToSkip = std::min(itemsAvailable, count);
+    destroy(readPos, readPos + itemsToSkip);
+    readPosition_.store(readPos + itemsToSkip, std::memory_order_release);
+    return itemsToSkip;
+}
+
+template <Element T, std::size_t Capacity> inline auto TypedRingBuffer<T, Capacity>::drain() noexcept -> SizeType {
+    if (!*this) [[unlikely]] {
+        return 0;
+    }
+
+    const auto writePos = writePosition_.load(std::memory_order_acquire);
+    const auto readPos = readPosition_.load(std::memory_order_relaxed);
+    cachedWritePosition_ = writePos;
+
+    if (writePos == readPos) [[unlikely]] {
+        return 0;
+    }
+
+    destroy(readPos, writePos);
+    readPosition_.store(writePos, std::memory_order_release);
+    return writePos - readPos;
+}
+
+// MARK: Internals
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::slot(SizeType position) const noexcept -> T * {
+    // Elements are constructed with std::construct_at so the slot may be reinterpreted and laundered
+    auto *bytes = static_cast<unsigned char *>(const_cast<void *>(static_cast<const void *>(storage_.bytes)));
+    return std::launder(reinterpret_cast<T *>(bytes + (position & (capacity() - 1)) * sizeof(T)));
+}
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::writableElements(SizeType writePos, SizeType count) const noexcept
+        -> SizeType {
+    if (const auto itemsFree = capacity() - (writePos - cachedReadPosition_); itemsFree >= count) [[likely]] {
+        return itemsFree;
+    }
+    cachedReadPosition_ = readPosition_.load(std::memory_order_acquire);
+    return capacity() - (writePos - cachedReadPosition_);
+}
+
+template <Element T, std::size_t Capacity>
+inline auto TypedRingBuffer<T, Capacity>::readableElements(SizeType readPos, SizeType count) const noexcept
+        -> SizeType {
+    if (const auto itemsUsed = cachedWritePosition_ - readPos; itemsUsed >= count) [[likely]] {
+        return itemsUsed;
+    }
+    cachedWritePosition_ = writePosition_.load(std::memory_order_acquire);
+    return cachedWritePosition_ - readPos;
+}
+
+template <Element T, std::size_t Capacity>
+inline void TypedRingBuffer<T, Capacity>::destroy(SizeType first, SizeType last) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (auto position = first; position != last; ++position) {
+            std::destroy_at(slot(position));
+        }
+    }
+}
+
+} /* namespace spsc */
+
+#endif
@@ -0,0 +1,196 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef SPSC_WAIT_STRATEGY_HPP
+#define SPSC_WAIT_STRATEGY_HPP
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace spsc {
+
+// MARK: Wait Phases
+
+/// The ways a thread may wait for the other side of a ring buffer.
+enum class WaitPhase {
+    /// Pause the processor briefly and poll again.
+    spin,
+    /// Yield the remainder of the time slice and poll again.
+    yield,
+    /// Block in the kernel until the other side makes progress.
+    park,
+};
+
+/// The number of times each phase of a wait strategy was entered.
+struct WaitCounters {
+    /// The number of times the waiting thread paused the processor.
+    std::uint64_t spins{0};
+    /// The number of times the waiting thread yielded.
+    std::uint64_t yields{0};
+    /// The number of times the waiting thread blocked in the kernel.
+    std::uint64_t parks{0};
+};
+
+/// A wait strategy chooses a phase for each unsuccessful poll of a ring buffer and counts the phases chosen.
+///
+/// ``phase`` is called with the number of preceding unsuccessful polls in the current wait, starting from zero.
+/// @note A wait strategy object and its counters are only safe to use from one thread at a time.
+template <typename W>
+concept WaitStrategy = requires(W &w, const W &cw, std::uint32_t attempt) {
+    { cw.phase(attempt) } noexcept -> std::same_as<WaitPhase>;
+    { w.counters } -> std::same_as<WaitCounters &>;
+};
+
+// MARK: Wait Strategies
+
+/// Blocks in the kernel as soon as the condition is unsatisfied.
+///
+/// This strategy uses no CPU while waiting but includes a system call on both sides in the wake latency.
+struct ParkWait {
+    /// The number of times each phase was entered.
+    WaitCounters counters{};
+
+    [[nodiscard]] constexpr WaitPhase phase(std::uint32_t /*attempt*/) const noexcept { return WaitPhase::park; }
+};
+
+/// Pauses the processor between polls and never blocks.
+///
+/// This strategy has the lowest wake latency and occupies a core for as long as it waits.
+struct BusySpinWait {
+    /// The number of times each phase was entered.
+    WaitCounters counters{};
+
+    [[nodiscard]] constexpr WaitPhase phase(std::uint32_t /*attempt*/) const noexcept { return WaitPhase::spin; }
+};
+
+/// Pauses the processor for a bounded number of polls, then yields between polls and never blocks.
+struct SpinYieldWait {
+    /// The number of polls during which the processor is paused.
+    std::uint32_t spinCount{1024};
+    /// The number of times each phase was entered.
+    WaitCounters counters{};
+
+    [[nodiscard]] constexpr WaitPhase phase(std::uint32_t attempt) const noexcept {
+        return attempt < spinCount ? WaitPhase::spin : WaitPhase::yield;
+    }
+};
+
+/// Pauses the processor for a bounded number of polls, then yields for a bounded number of polls, then blocks.
+///
+/// Waits that end quickly avoid the system calls of ``ParkWait`` while long waits do not occupy a core.
+struct SpinThenParkWait {
+    /// The number of polls during which the processor is paused.
+    std::uint32_t spinCount{1024};
+    /// The number of polls after spinning during which the thread yields.
+    std::uint32_t yieldCount{16};
+    /// The number of times each phase was entered.
+    WaitCounters counters{};
+
+    [[nodiscard]] constexpr WaitPhase phase(std::uint32_t attempt) const noexcept {
+        if (attempt < spinCount) {
+            return WaitPhase::spin;
+        }
+        return attempt - spinCount < yieldCount ? WaitPhase::yield : WaitPhase::park;
+    }
+};
+
+static_assert(WaitStrategy<ParkWait> && WaitStrategy<BusySpinWait> && WaitStrategy<SpinYieldWait> &&
+              WaitStrategy<SpinThenParkWait>);
+
+// MARK: Processor Hints
+
+/// Signals to the processor that the calling thread is in a spin loop.
+inline void cpuRelax() noexcept [[clang::nonblocking]] {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#elif defined(_M_ARM64) || defined(_M_ARM)
+    __yield();
+#endif
+}
+
+namespace detail {
+
+/// Blocks the calling thread until word does not contain expected, the thread is woken by ``wakeAddress``, or timeout
+/// elapses.
+/// @note Spurious wakeups are possible.
+/// @param word The word to wait on.
+/// @param expected The value of word for which to wait.
+/// @param timeout The maximum time to wait or nullptr to wait indefinitely.
+/// @param shared true if word is in memory shared with other processes, which may then wake the thread. Ignored on
+/// platforms without shared memory support.
+void waitOnAddress(std::atomic<std::uint32_t> &word, std::uint32_t expected, const std::chrono::nanoseconds *timeout,
+                   bool shared = false) noexcept [[clang::blocking]];
+
+/// Wakes a thread blocked in ``waitOnAddress`` on word.
+/// @param word The word the thread is waiting on.
+/// @param shared true if word is in memory shared with other processes, as passed to ``waitOnAddress``.
+void wakeAddress(std::atomic<std::uint32_t> &word, bool shared = false) noexcept;
+
+/// A coroutine suspended until one side of a ring buffer is ready, stored in the awaiter that suspended it.
+struct Continuation {
+    /// The suspended coroutine.
+    std::coroutine_handle<> coroutine{};
+    /// The number of bytes of data or free space required.
+    std::size_t count{0};
+    /// The function passing the coroutine to a scheduler, or nullptr to resume it on the notifying thread.
+    void (*schedule)(void *, std::coroutine_handle<>) noexcept {nullptr};
+    /// The scheduler passed to schedule.
+    void *scheduler{nullptr};
+
+    /// Resumes or schedules the coroutine.
+    /// @note The continuation may be destroyed when this method returns.
+    void resume() const noexcept {
+        if (schedule != nullptr) {
+            schedule(scheduler, coroutine);
+        } else {
+            // The handle is copied because resuming the coroutine may destroy this object
+            auto handle = coroutine;
+            handle.resume();
+        }
+    }
+};
+
+/// Occupies an awaiter slot while the side resuming its continuation examines it.
+inline constinit Continuation busyContinuation{};
+
+/// Performs the phase a wait strategy chooses for an unsuccessful poll and counts it.
+/// @return true if the caller should park, false if it should poll again.
+template <WaitStrategy W> inline bool idle(W &strategy, std::uint32_t attempt) noexcept {
+    switch (strategy.phase(attempt)) {
+    case WaitPhase::spin:
+        ++strategy.counters.spins;
+        cpuRelax();
+        return false;
+    case WaitPhase::yield:
+        ++strategy.counters.yields;
+        std::this_thread::yield();
+        return false;
+    case WaitPhase::park:
+        ++strategy.counters.parks;
+        return true;
+    }
+    return true;
+}
+
+} /* namespace detail */
+
+} /* namespace spsc */
+
+#endif
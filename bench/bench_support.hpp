@@ -0,0 +1,187 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef BENCH_SUPPORT_HPP
+#define BENCH_SUPPORT_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace bench {
+
+// MARK: Cycle Counter
+
+/// Returns the value of a free-running, constant-rate cycle counter.
+///
+/// This is the time stamp counter on x86 and the virtual counter on AArch64, whose rate is given by ``cntfrq_el0``
+/// rather than the core clock. Elsewhere it is the steady clock in nanoseconds.
+inline std::uint64_t readCycleCounter() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    return __rdtsc();
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    std::uint64_t value;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now().time_since_epoch())
+                                              .count());
+#endif
+}
+
+// MARK: Thread Placement
+
+/// Where the producer and consumer threads run relative to each other.
+enum class Placement : std::uint8_t {
+    /// The threads are not pinned.
+    unpinned,
+    /// Both threads are pinned to the same logical CPU.
+    sameCpu,
+    /// The threads are pinned to the two hardware threads of one core.
+    siblingThreads,
+    /// The threads are pinned to different cores in the same package.
+    otherCore,
+    /// The threads are pinned to cores in different packages.
+    crossSocket,
+};
+
+/// Returns a short name for placement.
+inline const char *placementName(Placement placement) noexcept {
+    switch (placement) {
+    case Placement::unpinned:
+        return "unpinned";
+    case Placement::sameCpu:
+        return "sameCpu";
+    case Placement::siblingThreads:
+        return "siblingThreads";
+    case Placement::otherCore:
+        return "otherCore";
+    case Placement::crossSocket:
+        return "crossSocket";
+    }
+    return "unknown";
+}
+
+/// All placements.
+inline constexpr Placement allPlacements[] = {Placement::unpinned, Placement::sameCpu, Placement::siblingThreads,
+                                              Placement::otherCore, Placement::crossSocket};
+
+/// Returns the logical CPUs for the producer and consumer for placement, or std::nullopt if the machine or platform
+/// cannot provide it. Both values are -1 for ``Placement::unpinned``.
+inline std::optional<std::pair<int, int>> selectCpus(Placement placement) {
+    if (placement == Placement::unpinned) {
+        return std::pair{-1, -1};
+    }
+
+#if defined(__linux__)
+    struct Cpu {
+        int id;
+        int package;
+        int core;
+    };
+
+    cpu_set_t allowed;
+    if (::sched_getaffinity(0, sizeof allowed, &allowed) != 0) {
+        return std::nullopt;
+    }
+
+    const auto readTopology = [](int cpu, const char *name) {
+        std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + name);
+        int value = -1;
+        file >> value;
+        return value;
+    };
+
+    std::vector<Cpu> cpus;
+    for (int id = 0; id < CPU_SETSIZE; ++id) {
+        if (CPU_ISSET(id, &allowed)) {
+            cpus.push_back({id, readTopology(id, "physical_package_id"), readTopology(id, "core_id")});
+        }
+    }
+    if (cpus.empty()) {
+        return std::nullopt;
+    }
+
+    if (placement == Placement::sameCpu) {
+        return std::pair{cpus.front().id, cpus.front().id};
+    }
+
+    for (const auto &a : cpus) {
+        for (const auto &b : cpus) {
+            if (a.id == b.id) {
+                continue;
+            }
+            const auto samePackage = a.package == b.package;
+            const auto sameCore = samePackage && a.core == b.core;
+            if ((placement == Placement::siblingThreads && sameCore) ||
+                (placement == Placement::otherCore && samePackage && !sameCore) ||
+                (placement == Placement::crossSocket && !samePackage)) {
+                return std::pair{a.id, b.id};
+            }
+        }
+    }
+#endif
+
+    return std::nullopt;
+}
+
+/// Pins the calling thread to a logical CPU for as long as the object exists.
+///
+/// A CPU of -1 leaves the thread unpinned.
+class ScopedPin final {
+  public:
+    explicit ScopedPin(int cpu) noexcept {
+#if defined(__linux__)
+        if (cpu >= 0 && ::pthread_getaffinity_np(::pthread_self(), sizeof previous_, &previous_) == 0) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            pinned_ = ::pthread_setaffinity_np(::pthread_self(), sizeof set, &set) == 0;
+        }
+#else
+        (void)cpu;
+#endif
+    }
+
+    ScopedPin(const ScopedPin &) = delete;
+    ScopedPin &operator=(const ScopedPin &) = delete;
+
+    ~ScopedPin() noexcept {
+#if defined(__linux__)
+        if (pinned_) {
+            ::pthread_setaffinity_np(::pthread_self(), sizeof previous_, &previous_);
+        }
+#endif
+    }
+
+  private:
+#if defined(__linux__)
+    cpu_set_t previous_{};
+    bool pinned_{false};
+#endif
+};
+
+} /* namespace bench */
+
+#endif
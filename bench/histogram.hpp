@@ -0,0 +1,97 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#ifndef BENCH_HISTOGRAM_HPP
+#define BENCH_HISTOGRAM_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace bench {
+
+/// A histogram of unsigned values with bounded relative error, in the manner of an HDR histogram.
+///
+/// Values below 2^SubBucketBits are counted exactly. Larger values are counted in buckets whose width is a fixed
+/// fraction of their magnitude, so every recorded value is reported within 2^-SubBucketBits of its true value.
+/// @tparam SubBucketBits The number of bits of precision retained for each value.
+template <unsigned SubBucketBits = 7> class Histogram final {
+  public:
+    Histogram() : counts_((65 - SubBucketBits) << SubBucketBits) {}
+
+    /// Counts value.
+    void record(std::uint64_t value) noexcept {
+        ++counts_[indexOf(value)];
+        ++count_;
+        sum_ += static_cast<double>(value);
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    /// Returns the number of values recorded.
+    [[nodiscard]] std::uint64_t count() const noexcept { return count_; }
+
+    /// Returns the smallest value recorded, or 0 if none have been.
+    [[nodiscard]] std::uint64_t min() const noexcept { return count_ == 0 ? 0 : min_; }
+
+    /// Returns the largest value recorded.
+    [[nodiscard]] std::uint64_t max() const noexcept { return max_; }
+
+    /// Returns the mean of the values recorded, or 0 if none have been.
+    [[nodiscard]] double mean() const noexcept { return count_ == 0 ? 0 : sum_ / static_cast<double>(count_); }
+
+    /// Returns the smallest value not exceeded by the fraction q of recorded values, as the largest value equivalent
+    /// to its bucket.
+    /// @param q A fraction between 0 and 1, such as 0.999 for the 99.9th percentile.
+    [[nodiscard]] std::uint64_t percentile(double q) const noexcept {
+        if (count_ == 0) {
+            return 0;
+        }
+        const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(q * static_cast<double>(count_) + 0.5));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return std::min(highestEquivalentValue(i), max_);
+            }
+        }
+        return max_;
+    }
+
+  private:
+    static constexpr std::uint64_t subBucketCount = std::uint64_t{1} << SubBucketBits;
+
+    static std::size_t indexOf(std::uint64_t value) noexcept {
+        if (value < subBucketCount) {
+            return static_cast<std::size_t>(value);
+        }
+        const auto shift = static_cast<unsigned>(std::bit_width(value)) - 1 - SubBucketBits;
+        return static_cast<std::size_t>(((shift + 1) << SubBucketBits) + ((value >> shift) - subBucketCount));
+    }
+
+    static std::uint64_t highestEquivalentValue(std::size_t index) noexcept {
+        if (index < subBucketCount) {
+            return index;
+        }
+        const auto shift = static_cast<unsigned>(index >> SubBucketBits) - 1;
+        const auto lowest = ((index & (subBucketCount - 1)) + subBucketCount) << shift;
+        return lowest + ((std::uint64_t{1} << shift) - 1);
+    }
+
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t count_{0};
+    double sum_{0};
+    std::uint64_t min_{std::numeric_limits<std::uint64_t>::max()};
+    std::uint64_t max_{0};
+};
+
+} /* namespace bench */
+
+#endif
@@ -0,0 +1,256 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+// Measures round-trip handoff latency by bouncing timestamped messages between two threads over a pair of ring
+// buffers, and reports latency percentiles for each wait strategy and message size as CSV or JSON.
+//
+// Message sizes that do not divide the capacity periodically straddle the end of the buffer; samples for which
+// they did are also reported separately, isolating the wrap-around paths of write and read.
+
+#include "bench_support.hpp"
+#include "histogram.hpp"
+#include "spsc/RingBuffer.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// A message of Size bytes beginning with the time it was sent.
+template <std::size_t Size> struct Message {
+    static_assert(Size > sizeof(std::uint64_t));
+    std::uint64_t timestamp;
+    unsigned char payload[Size - sizeof(std::uint64_t)];
+};
+
+struct Options {
+    std::size_t capacity{4096};
+    std::uint64_t iterations{100'000};
+    std::uint64_t warmup{10'000};
+    bench::Placement placement{bench::Placement::unpinned};
+    std::string strategy;
+    bool json{false};
+    std::string output;
+};
+
+/// The summary of one histogram.
+struct Result {
+    std::string strategy;
+    std::size_t messageSize;
+    const char *path;
+    bench::Histogram<> histogram;
+};
+
+/// Returns the number of nanoseconds per tick of ``bench::readCycleCounter()``.
+double calibrateCycleCounter() {
+    const auto startTime = std::chrono::steady_clock::now();
+    const auto startTicks = bench::readCycleCounter();
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    const auto ticks = bench::readCycleCounter() - startTicks;
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - startTime;
+    return elapsed.count() / static_cast<double>(ticks);
+}
+
+/// Bounces messages of Size bytes between two threads and records round-trip times in nanoseconds.
+template <typename W, std::size_t Size>
+void pingPong(const Options &options, const char *strategyName, double nanosecondsPerTick,
+              const std::pair<int, int> &cpus, std::vector<Result> &results) {
+    spsc::RingBuffer ping(options.capacity);
+    spsc::RingBuffer pong(options.capacity);
+    const auto total = options.warmup + options.iterations;
+
+    std::thread echo([&] {
+        const bench::ScopedPin pin{cpus.second};
+        W strategy{};
+        Message<Size> message;
+        for (std::uint64_t i = 0; i < total; ++i) {
+            ping.readWait(message, strategy);
+            pong.writeWait(message, strategy);
+        }
+    });
+
+    Result all{strategyName, Size, "all", {}};
+    Result contiguous{strategyName, Size, "contiguous", {}};
+    Result wrapped{strategyName, Size, "wrapped", {}};
+    {
+        const bench::ScopedPin pin{cpus.first};
+        W strategy{};
+        Message<Size> message{};
+        for (std::uint64_t i = 0; i < total; ++i) {
+            // Both rings move in lockstep, so every copy of this message wraps if the first one does
+            const auto wraps = (ping.writePosition() & (options.capacity - 1)) + Size > options.capacity;
+
+            message.timestamp = bench::readCycleCounter();
+            ping.writeWait(message, strategy);
+            pong.readWait(message, strategy);
+            const auto ticks = bench::readCycleCounter() - message.timestamp;
+
+            if (i < options.warmup) {
+                continue;
+            }
+            const auto nanoseconds = static_cast<std::uint64_t>(static_cast<double>(ticks) * nanosecondsPerTick);
+            all.histogram.record(nanoseconds);
+            (wraps ? wrapped : contiguous).histogram.record(nanoseconds);
+        }
+    }
+    echo.join();
+
+    results.push_back(std::move(all));
+    if (wrapped.histogram.count() > 0) {
+        results.push_back(std::move(contiguous));
+        results.push_back(std::move(wrapped));
+    }
+}
+
+template <typename W> void runStrategy(const Options &options, const char *name, double nanosecondsPerTick,
+                                       const std::pair<int, int> &cpus, std::vector<Result> &results) {
+    if (!options.strategy.empty() && options.strategy != name) {
+        return;
+    }
+    std::fprintf(stderr, "Measuring %s\n", name);
+    pingPong<W, 16>(options, name, nanosecondsPerTick, cpus, results);
+    pingPong<W, 64>(options, name, nanosecondsPerTick, cpus, results);
+    pingPong<W, 512>(options, name, nanosecondsPerTick, cpus, results);
+    // Sizes that do not divide the capacity exercise the wrap-around paths
+    pingPong<W, 24>(options, name, nanosecondsPerTick, cpus, results);
+    pingPong<W, 72>(options, name, nanosecondsPerTick, cpus, results);
+    pingPong<W, 520>(options, name, nanosecondsPerTick, cpus, results);
+}
+
+void writeCsv(std::FILE *file, const std::vector<Result> &results) {
+    std::fprintf(file, "strategy,message_size,path,count,min_ns,mean_ns,p50_ns,p99_ns,p99_9_ns,max_ns\n");
+    for (const auto &result : results) {
+        const auto &h = result.histogram;
+        std::fprintf(file, "%s,%zu,%s,%llu,%llu,%.1f,%llu,%llu,%llu,%llu\n", result.strategy.c_str(),
+                     result.messageSize, result.path, static_cast<unsigned long long>(h.count()),
+                     static_cast<unsigned long long>(h.min()), h.mean(),
+                     static_cast<unsigned long long>(h.percentile(0.5)),
+                     static_cast<unsigned long long>(h.percentile(0.99)),
+                     static_cast<unsigned long long>(h.percentile(0.999)), static_cast<unsigned long long>(h.max()));
+    }
+}
+
+void writeJson(std::FILE *file, const Options &options, const std::vector<Result> &results) {
+    std::fprintf(file, "{\n  \"capacity\": %zu,\n  \"iterations\": %llu,\n  \"placement\": \"%s\",\n  \"results\": [\n",
+                 options.capacity, static_cast<unsigned long long>(options.iterations),
+                 bench::placementName(options.placement));
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto &result = results[i];
+        const auto &h = result.histogram;
+        std::fprintf(file,
+                     "    {\"strategy\": \"%s\", \"message_size\": %zu, \"path\": \"%s\", \"count\": %llu, "
+                     "\"min_ns\": %llu, \"mean_ns\": %.1f, \"p50_ns\": %llu, \"p99_ns\": %llu, \"p99_9_ns\": %llu, "
+                     "\"max_ns\": %llu}%s\n",
+                     result.strategy.c_str(), result.messageSize, result.path,
+                     static_cast<unsigned long long>(h.count()), static_cast<unsigned long long>(h.min()), h.mean(),
+                     static_cast<unsigned long long>(h.percentile(0.5)),
+                     static_cast<unsigned long long>(h.percentile(0.99)),
+                     static_cast<unsigned long long>(h.percentile(0.999)), static_cast<unsigned long long>(h.max()),
+                     i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(file, "  ]\n}\n");
+}
+
+void usage(const char *program) {
+    std::fprintf(stderr,
+                 "Usage: %s [--capacity=BYTES] [--iterations=N] [--warmup=N] [--strategy=NAME] "
+                 "[--placement=NAME] [--format=csv|json] [--output=FILE]\n"
+                 "Strategies: ParkWait, BusySpinWait, SpinYieldWait, SpinThenParkWait\n"
+                 "Placements: unpinned, sameCpu, siblingThreads, otherCore, crossSocket\n",
+                 program);
+}
+
+/// Parses the command line into options, returning false if it is invalid.
+bool parseOptions(int argc, char **argv, Options &options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view argument{argv[i]};
+        const auto equals = argument.find('=');
+        const auto name = argument.substr(0, equals);
+        const auto value = equals == std::string_view::npos ? std::string{} : std::string{argument.substr(equals + 1)};
+
+        if (name == "--capacity") {
+            options.capacity = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (name == "--iterations") {
+            options.iterations = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (name == "--warmup") {
+            options.warmup = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (name == "--strategy") {
+            options.strategy = value;
+        } else if (name == "--placement") {
+            auto found = false;
+            for (const auto placement : bench::allPlacements) {
+                if (value == bench::placementName(placement)) {
+                    options.placement = placement;
+                    found = true;
+                }
+            }
+            if (!found) {
+                return false;
+            }
+        } else if (name == "--format") {
+            if (value != "csv" && value != "json") {
+                return false;
+            }
+            options.json = value == "json";
+        } else if (name == "--output") {
+            options.output = value;
+        } else {
+            return false;
+        }
+    }
+
+    // Each ring buffer must hold the largest message
+    return options.capacity >= 1024 && (options.capacity & (options.capacity - 1)) == 0 && options.iterations > 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const auto cpus = bench::selectCpus(options.placement);
+    if (!cpus) {
+        std::fprintf(stderr, "Placement %s is not available on this machine\n",
+                     bench::placementName(options.placement));
+        return EXIT_FAILURE;
+    }
+
+    const auto nanosecondsPerTick = calibrateCycleCounter();
+
+    std::vector<Result> results;
+    runStrategy<spsc::ParkWait>(options, "ParkWait", nanosecondsPerTick, *cpus, results);
+    runStrategy<spsc::BusySpinWait>(options, "BusySpinWait", nanosecondsPerTick, *cpus, results);
+    runStrategy<spsc::SpinYieldWait>(options, "SpinYieldWait", nanosecondsPerTick, *cpus, results);
+    runStrategy<spsc::SpinThenParkWait>(options, "SpinThenParkWait", nanosecondsPerTick, *cpus, results);
+
+    auto *file = options.output.empty() ? stdout : std::fopen(options.output.c_str(), "w");
+    if (file == nullptr) {
+        std::perror(options.output.c_str());
+        return EXIT_FAILURE;
+    }
+    if (options.json) {
+        writeJson(file, options, results);
+    } else {
+        writeCsv(file, results);
+    }
+    if (file != stdout) {
+        std::fclose(file);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,307 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "bench_support.hpp"
+#include "spsc/RingBuffer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t KB = 1024;
+constexpr std::size_t MB = 1024 * KB;
+
+/// The ring buffer methods used to transfer a message.
+enum class Api : std::uint8_t {
+    /// ``write()`` and ``read()`` of raw bytes.
+    readWrite,
+    /// ``write(const T &)`` and ``read(T &)`` of the whole message.
+    value,
+    /// ``writeAll()`` and ``readAll()`` of a sequence number and a payload.
+    all,
+    /// ``writeVector()``/``commitWrite()`` and ``readVector()``/``commitRead()``.
+    vector,
+};
+
+const char *apiName(Api api) noexcept {
+    switch (api) {
+    case Api::readWrite:
+        return "readWrite";
+    case Api::value:
+        return "value";
+    case Api::all:
+        return "all";
+    case Api::vector:
+        return "vector";
+    }
+    return "unknown";
+}
+
+/// Opaque message content, which unlike std::array is not a range and so may be passed to ``writeAll()``.
+template <std::size_t Size> struct Payload {
+    unsigned char bytes[Size];
+};
+
+/// A message of MessageSize bytes.
+template <std::size_t MessageSize> struct Message {
+    static_assert(MessageSize > sizeof(std::uint64_t));
+    std::uint64_t sequence;
+    Payload<MessageSize - sizeof(std::uint64_t)> payload;
+};
+
+/// Copies count bytes from src into the regions of a write vector.
+void copyToVector(const spsc::RingBuffer::WriteVector &vector, const unsigned char *src, std::size_t count) noexcept {
+    const auto toFront = std::min(count, vector.first.size());
+    std::memcpy(vector.first.data(), src, toFront);
+    std::memcpy(vector.second.data(), src + toFront, count - toFront);
+}
+
+/// Copies count bytes from the regions of a read vector into dst.
+void copyFromVector(const spsc::RingBuffer::ReadVector &vector, unsigned char *dst, std::size_t count) noexcept {
+    const auto fromFront = std::min(count, vector.first.size());
+    std::memcpy(dst, vector.first.data(), fromFront);
+    std::memcpy(dst + fromFront, vector.second.data(), count - fromFront);
+}
+
+template <Api A, std::size_t MessageSize> bool send(spsc::RingBuffer &rb, Message<MessageSize> &message) noexcept {
+    if constexpr (A == Api::readWrite) {
+        return rb.write(&message, sizeof message, 1, false) == 1;
+    } else if constexpr (A == Api::value) {
+        return rb.write(message);
+    } else if constexpr (A == Api::all) {
+        return rb.writeAll(message.sequence, message.payload);
+    } else {
+        const auto vector = rb.writeVector(sizeof message);
+        if (vector.first.size() + vector.second.size() < sizeof message) {
+            return false;
+        }
+        copyToVector(vector, reinterpret_cast<const unsigned char *>(&message), sizeof message);
+        rb.commitWrite(sizeof message);
+        return true;
+    }
+}
+
+template <Api A, std::size_t MessageSize> bool receive(spsc::RingBuffer &rb, Message<MessageSize> &message) noexcept {
+    if constexpr (A == Api::readWrite) {
+        return rb.read(&message, sizeof message, 1, false) == 1;
+    } else if constexpr (A == Api::value) {
+        return rb.read(message);
+    } else if constexpr (A == Api::all) {
+        return rb.readAll(message.sequence, message.payload);
+    } else {
+        const auto vector = rb.readVector(sizeof message);
+        if (vector.first.size() + vector.second.size() < sizeof message) {
+            return false;
+        }
+        copyFromVector(vector, reinterpret_cast<unsigned char *>(&message), sizeof message);
+        rb.commitRead(sizeof message);
+        return true;
+    }
+}
+
+/// Measures transferring messages from the benchmark thread to a consumer thread.
+///
+/// Arguments are the ring buffer capacity and the thread placement.
+template <Api A, std::size_t MessageSize> void transfer(benchmark::State &state) {
+    const auto capacity = static_cast<std::size_t>(state.range(0));
+    const auto placement = static_cast<bench::Placement>(state.range(1));
+
+    const auto cpus = bench::selectCpus(placement);
+    if (!cpus) {
+        state.SkipWithError("Placement not available on this machine");
+        return;
+    }
+
+    // Threads sharing a CPU make progress only if they give it up when blocked
+    const auto yieldWhenBlocked = placement == bench::Placement::sameCpu;
+
+    spsc::RingBuffer rb(capacity);
+    std::atomic<bool> done{false};
+
+    std::thread consumer([&] {
+        const bench::ScopedPin pin{cpus->second};
+        Message<MessageSize> message;
+        while (!done.load(std::memory_order_relaxed)) {
+            if (receive<A>(rb, message)) {
+                benchmark::DoNotOptimize(message.sequence);
+            } else if (yieldWhenBlocked) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::uint64_t messages = 0;
+    std::uint64_t cycles = 0;
+    {
+        const bench::ScopedPin pin{cpus->first};
+        Message<MessageSize> message{};
+        const auto start = bench::readCycleCounter();
+        for (auto _ : state) {
+            message.sequence = messages;
+            while (!send<A>(rb, message)) {
+                if (yieldWhenBlocked) {
+                    std::this_thread::yield();
+                }
+            }
+            ++messages;
+        }
+        cycles = bench::readCycleCounter() - start;
+    }
+
+    done.store(true, std::memory_order_relaxed);
+    consumer.join();
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(messages));
+    state.SetBytesProcessed(static_cast<std::int64_t>(messages * MessageSize));
+    state.counters["cycles/op"] = messages > 0 ? static_cast<double>(cycles) / static_cast<double>(messages) : 0;
+}
+
+template <Api A, std::size_t MessageSize> void registerTransfer() {
+    for (const auto capacity : {4 * KB, 64 * KB, 1 * MB}) {
+        // A ring buffer must hold at least a few messages to be exercised
+        if (capacity < 4 * MessageSize) {
+            continue;
+        }
+        for (const auto placement : bench::allPlacements) {
+            const auto name = std::string{"transfer/"} + apiName(A) + "/" + std::to_string(MessageSize) + "B/" +
+                              std::to_string(capacity / KB) + "KB/" + bench::placementName(placement);
+            benchmark::RegisterBenchmark(name.c_str(), transfer<A, MessageSize>)
+                    ->Args({static_cast<std::int64_t>(capacity), static_cast<std::int64_t>(placement)})
+                    ->MinWarmUpTime(0.1)
+                    ->UseRealTime();
+        }
+    }
+}
+
+template <Api A> void registerTransfers() {
+    registerTransfer<A, 16>();
+    registerTransfer<A, 64>();
+    registerTransfer<A, 512>();
+    registerTransfer<A, 4096>();
+}
+
+/// Measures a write immediately followed by a read on one thread, without contention.
+template <Api A, std::size_t MessageSize> void roundTrip(benchmark::State &state) {
+    spsc::RingBuffer rb(static_cast<std::size_t>(state.range(0)));
+    Message<MessageSize> message{};
+
+    const auto start = bench::readCycleCounter();
+    for (auto _ : state) {
+        send<A>(rb, message);
+        receive<A>(rb, message);
+        benchmark::DoNotOptimize(message);
+    }
+    const auto cycles = bench::readCycleCounter() - start;
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(MessageSize));
+    state.counters["cycles/op"] = static_cast<double>(cycles) / static_cast<double>(state.iterations());
+}
+
+BENCHMARK(roundTrip<Api::readWrite, 16>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::value, 16>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::value, 24>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::value, 64>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::all, 24>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::all, 64>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::all, 16>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::vector, 16>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::readWrite, 4096>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::all, 4096>)->Arg(1 * MB);
+BENCHMARK(roundTrip<Api::vector, 4096>)->Arg(1 * MB);
+
+/// Measures copying runtime sizes between 8 and 64 bytes with ``std::memcpy`` or ``spsc::detail::copySmall()``.
+///
+/// The argument selects the kernel. The sizes vary pseudo-randomly so neither kernel benefits from a fixed size.
+template <bool UseCopySmall> void smallCopy(benchmark::State &state) {
+    std::array<unsigned char, 128> src{};
+    std::array<unsigned char, 128> dst{};
+    std::array<std::size_t, 256> sizes{};
+    std::uint32_t seed = 1;
+    for (auto &size : sizes) {
+        seed = seed * 1'664'525 + 1'013'904'223;
+        size = 8 + (seed >> 16) % 57;
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const auto size = sizes[i++ % sizes.size()];
+        benchmark::DoNotOptimize(size);
+        if constexpr (UseCopySmall) {
+            spsc::detail::copySmall(dst.data(), src.data(), size);
+        } else {
+            std::memcpy(dst.data(), src.data(), size);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(smallCopy<false>)->Name("smallCopy/memcpy");
+BENCHMARK(smallCopy<true>)->Name("smallCopy/copySmall");
+
+/// Measures the time to traverse a working set after a large write with each copy mode.
+///
+/// The argument is the ``spsc::CopyMode``. A streaming write leaves more of the working set in the cache. The large
+/// copies are untimed, so the iteration count is fixed to keep the run short.
+void cachePollution(benchmark::State &state) {
+    constexpr std::size_t transferSize = 32 * MB;
+    const auto mode = static_cast<spsc::CopyMode>(state.range(0));
+
+    spsc::RingBuffer rb(2 * transferSize);
+    const std::vector<unsigned char> data(transferSize, 0xA5);
+    std::vector<unsigned char> sink(transferSize);
+    // A working set that fits in a typical L2 cache
+    std::vector<std::uint64_t> workingSet(256 * KB / sizeof(std::uint64_t), 1);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        rb.read(sink.data(), 1, sink.size(), false);
+        benchmark::DoNotOptimize(std::accumulate(workingSet.begin(), workingSet.end(), std::uint64_t{0}));
+        rb.write(data.data(), 1, data.size(), false, mode);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(std::accumulate(workingSet.begin(), workingSet.end(), std::uint64_t{0}));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(workingSet.size() * sizeof(std::uint64_t)));
+}
+
+BENCHMARK(cachePollution)
+        ->ArgName("mode")
+        ->Arg(static_cast<std::int64_t>(spsc::CopyMode::standard))
+        ->Arg(static_cast<std::int64_t>(spsc::CopyMode::streaming))
+        ->Iterations(50);
+
+} // namespace
+
+int main(int argc, char **argv) {
+    registerTransfers<Api::readWrite>();
+    registerTransfers<Api::value>();
+    registerTransfers<Api::all>();
+    registerTransfers<Api::vector>();
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,179 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/RingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// A coroutine that starts immediately and destroys itself when it finishes.
+struct Task {
+    struct promise_type {
+        Task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+/// A scheduler that records coroutines for the test to resume.
+struct QueueScheduler {
+    std::vector<std::coroutine_handle<>> queue;
+
+    void operator()(std::coroutine_handle<> coroutine) noexcept { queue.push_back(coroutine); }
+};
+
+/// A scheduler whose coroutines are resumed by a thread calling ``run``.
+class Executor {
+  public:
+    void operator()(std::coroutine_handle<> coroutine) noexcept {
+        const std::lock_guard lock{mutex_};
+        queue_.push_back(coroutine);
+    }
+
+    /// Resumes scheduled coroutines until done is set.
+    void run(const std::atomic<bool> &done) {
+        while (!done.load()) {
+            std::coroutine_handle<> coroutine;
+            {
+                const std::lock_guard lock{mutex_};
+                if (!queue_.empty()) {
+                    coroutine = queue_.front();
+                    queue_.pop_front();
+                }
+            }
+            if (coroutine) {
+                coroutine.resume();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+  private:
+    std::mutex mutex_;
+    std::deque<std::coroutine_handle<>> queue_;
+};
+
+Task readValues(spsc::RingBuffer &rb, std::uint32_t count, std::vector<std::uint32_t> &values) {
+    for (std::uint32_t i = 0; i < count; ++i) {
+        EXPECT_TRUE(co_await rb.readable(sizeof(std::uint32_t)));
+        std::uint32_t value = 0;
+        EXPECT_TRUE(rb.read(value));
+        values.push_back(value);
+    }
+}
+
+} // namespace
+
+TEST(AwaitTest, ReadableResumesOnceDataIsAvailable) {
+    spsc::RingBuffer rb(64);
+    std::vector<std::uint32_t> values;
+
+    readValues(rb, 2, values);
+    EXPECT_TRUE(values.empty());
+
+    // A partial value does not satisfy the awaiter
+    ASSERT_TRUE(rb.write(std::uint16_t{1}));
+    rb.notifyConsumer();
+    EXPECT_TRUE(values.empty());
+    ASSERT_TRUE(rb.skip<std::uint16_t>());
+
+    ASSERT_TRUE(rb.write(std::uint32_t{7}));
+    rb.notifyConsumer();
+    ASSERT_EQ(values.size(), 1);
+    EXPECT_EQ(values[0], 7);
+
+    // Data written before the coroutine suspends is read without suspending
+    ASSERT_TRUE(rb.writeWait(std::uint32_t{8}));
+    ASSERT_EQ(values.size(), 2);
+    EXPECT_EQ(values[1], 8);
+}
+
+TEST(AwaitTest, WritableResumesOnceSpaceIsFree) {
+    spsc::RingBuffer rb(16);
+    ASSERT_TRUE(rb.writeAll(std::uint64_t{1}, std::uint64_t{2}));
+
+    auto written = false;
+    [](spsc::RingBuffer &rb, bool &written) -> Task {
+        EXPECT_TRUE(co_await rb.writable(8));
+        written = rb.write(std::uint64_t{3});
+    }(rb, written);
+    EXPECT_FALSE(written);
+
+    std::uint64_t value = 0;
+    ASSERT_TRUE(rb.readWait(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(written);
+}
+
+TEST(AwaitTest, UnsatisfiableCountDoesNotSuspend) {
+    spsc::RingBuffer rb(16);
+
+    auto result = true;
+    [](spsc::RingBuffer &rb, bool &result) -> Task { result = co_await rb.readable(17); }(rb, result);
+    EXPECT_FALSE(result);
+}
+
+TEST(AwaitTest, SchedulerReceivesCoroutine) {
+    spsc::RingBuffer rb(64);
+    QueueScheduler scheduler;
+
+    auto resumed = false;
+    [](spsc::RingBuffer &rb, QueueScheduler &scheduler, bool &resumed) -> Task {
+        co_await rb.readable(4, scheduler);
+        resumed = true;
+    }(rb, scheduler, resumed);
+
+    ASSERT_TRUE(rb.write(std::uint32_t{1}));
+    rb.notifyConsumer();
+    ASSERT_EQ(scheduler.queue.size(), 1);
+    EXPECT_FALSE(resumed);
+
+    scheduler.queue[0].resume();
+    EXPECT_TRUE(resumed);
+}
+
+TEST(AwaitTest, ProducerThreadResumesConsumerCoroutine) {
+    spsc::RingBuffer rb(128);
+    constexpr std::uint64_t count = 100'000;
+    Executor executor;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            ASSERT_TRUE(rb.writeWait(i, spsc::SpinThenParkWait{.spinCount = 16, .yieldCount = 1}));
+        }
+    });
+
+    [](spsc::RingBuffer &rb, Executor &executor, std::atomic<bool> &done) -> Task {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::uint64_t value = 0;
+            while (!rb.read(value)) {
+                co_await rb.readable(sizeof value, executor);
+            }
+            rb.notifyProducer();
+            EXPECT_EQ(value, i);
+        }
+        done.store(true);
+    }(rb, executor, done);
+
+    executor.run(done);
+    producer.join();
+    EXPECT_TRUE(rb.isEmpty());
+}
@@ -0,0 +1,150 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/BlockPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(BlockPoolTest, Allocation) {
+    spsc::BlockPool pool;
+    EXPECT_FALSE(pool);
+    EXPECT_EQ(pool.blockCount(), 0);
+    EXPECT_FALSE(pool.acquire());
+    EXPECT_FALSE(pool.receive());
+
+    EXPECT_FALSE(pool.allocate(0, 64));
+    EXPECT_FALSE(pool.allocate(4, 0));
+    ASSERT_TRUE(pool.allocate(3, 100));
+    EXPECT_EQ(pool.blockCount(), 3);
+    EXPECT_EQ(pool.blockSize(), 100);
+    EXPECT_EQ(pool.freeBlocks(), 3);
+
+    EXPECT_THROW(spsc::BlockPool(0, 64), std::invalid_argument);
+}
+
+TEST(BlockPoolTest, BlocksAreDistinctAndAligned) {
+    spsc::BlockPool<float> pool(5, 3);
+
+    std::vector<spsc::BlockPool<float>::Block> blocks;
+    while (auto block = pool.acquire()) {
+        EXPECT_EQ(block->data.size(), 3);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block->data.data()) % spsc::cacheLineSize, 0);
+        blocks.push_back(*block);
+    }
+    ASSERT_EQ(blocks.size(), 5);
+    EXPECT_EQ(pool.freeBlocks(), 0);
+
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        for (std::size_t j = i + 1; j < blocks.size(); ++j) {
+            EXPECT_NE(blocks[i].index, blocks[j].index);
+            EXPECT_NE(blocks[i].data.data(), blocks[j].data.data());
+        }
+    }
+}
+
+TEST(BlockPoolTest, SubmitAndRelease) {
+    spsc::BlockPool pool(2, 16);
+
+    auto block = pool.acquire();
+    ASSERT_TRUE(block);
+    std::iota(block->data.begin(), block->data.begin() + 8, 1);
+    pool.submit(block->index, 8);
+    EXPECT_EQ(pool.filledBlocks(), 1);
+
+    auto other = pool.acquire();
+    ASSERT_TRUE(other);
+    EXPECT_FALSE(pool.acquire());
+    // Counts larger than the block are clamped
+    pool.submit(other->index, 100);
+
+    auto received = pool.receive();
+    ASSERT_TRUE(received);
+    EXPECT_EQ(received->index, block->index);
+    EXPECT_EQ(received->data.data(), block->data.data());
+    ASSERT_EQ(received->data.size(), 8);
+    for (std::size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(received->data[i], i + 1);
+    }
+    pool.release(received->index);
+
+    received = pool.receive();
+    ASSERT_TRUE(received);
+    EXPECT_EQ(received->data.size(), 16);
+    EXPECT_FALSE(pool.receive());
+
+    // Only the released block is free until the other is released
+    auto reacquired = pool.acquire();
+    ASSERT_TRUE(reacquired);
+    EXPECT_EQ(reacquired->index, block->index);
+    EXPECT_FALSE(pool.acquire());
+    pool.release(received->index);
+    EXPECT_TRUE(pool.acquire());
+}
+
+TEST(BlockPoolTest, Move) {
+    spsc::BlockPool pool(4, 32);
+    auto block = pool.acquire();
+    ASSERT_TRUE(block);
+    block->data[0] = 42;
+    pool.submit(block->index, 1);
+
+    spsc::BlockPool moved(std::move(pool));
+    EXPECT_FALSE(pool);
+    auto received = moved.receive();
+    ASSERT_TRUE(received);
+    EXPECT_EQ(received->data[0], 42);
+    moved.release(received->index);
+
+    pool = std::move(moved);
+    EXPECT_FALSE(moved);
+    EXPECT_EQ(pool.freeBlocks(), 4);
+}
+
+TEST(BlockPoolTest, ProducerConsumer) {
+    spsc::BlockPool<std::uint64_t> pool(4, 256);
+    constexpr std::uint64_t count = 20'000;
+
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::optional<spsc::BlockPool<std::uint64_t>::Block> block;
+            while (!(block = pool.acquire())) {
+                std::this_thread::yield();
+            }
+            const auto size = 1 + i % block->data.size();
+            for (std::size_t j = 0; j < size; ++j) {
+                block->data[j] = i + j;
+            }
+            pool.submit(block->index, size);
+        }
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < count) {
+        auto block = pool.receive();
+        if (!block) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(block->data.size(), 1 + expected % 256);
+        for (std::size_t j = 0; j < block->data.size(); ++j) {
+            ASSERT_EQ(block->data[j], expected + j);
+        }
+        pool.release(block->index);
+        ++expected;
+    }
+
+    producer.join();
+    EXPECT_FALSE(pool.receive());
+}
@@ -0,0 +1,159 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/EventNotifier.hpp"
+#include "spsc/RingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+#include <poll.h>
+
+namespace {
+
+/// Returns true if the notifier's descriptor becomes readable within timeout milliseconds.
+bool isSignaled(const spsc::EventNotifier &notifier, int timeout = 0) {
+    ::pollfd pfd{.fd = notifier.fd(), .events = POLLIN, .revents = 0};
+    return ::poll(&pfd, 1, timeout) == 1 && (pfd.revents & POLLIN) != 0;
+}
+
+} // namespace
+
+TEST(EventNotifierTest, SignalsCoalesce) {
+    spsc::EventNotifier notifier;
+    EXPECT_FALSE(notifier);
+    EXPECT_EQ(notifier.fd(), -1);
+
+    ASSERT_TRUE(notifier.open());
+    EXPECT_TRUE(notifier);
+    EXPECT_FALSE(isSignaled(notifier));
+
+    notifier.signal();
+    notifier.signal();
+    EXPECT_TRUE(isSignaled(notifier));
+    notifier.clear();
+    EXPECT_FALSE(isSignaled(notifier));
+
+    spsc::EventNotifier moved(std::move(notifier));
+    EXPECT_FALSE(notifier);
+    moved.signal();
+    EXPECT_TRUE(isSignaled(moved));
+}
+
+TEST(EventNotifierTest, SignaledOnceWhenDataArrives) {
+    spsc::RingBuffer rb(64);
+    spsc::EventNotifier notifier;
+    ASSERT_TRUE(notifier.open());
+
+    ASSERT_TRUE(rb.armReadable(notifier));
+    rb.notifyConsumer();
+    EXPECT_FALSE(isSignaled(notifier));
+
+    ASSERT_TRUE(rb.write(std::uint32_t{1}));
+    rb.notifyConsumer();
+    EXPECT_TRUE(isSignaled(notifier));
+    notifier.clear();
+
+    // The notifier is disarmed until the consumer arms it again
+    ASSERT_TRUE(rb.write(std::uint32_t{2}));
+    rb.notifyConsumer();
+    EXPECT_FALSE(isSignaled(notifier));
+
+    // Arming fails while data is available
+    EXPECT_FALSE(rb.armReadable(notifier));
+    rb.skip<std::uint32_t>(2);
+    ASSERT_TRUE(rb.armReadable(notifier));
+    rb.disarm(notifier);
+    ASSERT_TRUE(rb.write(std::uint32_t{3}));
+    rb.notifyConsumer();
+    EXPECT_FALSE(isSignaled(notifier));
+}
+
+TEST(EventNotifierTest, SignaledWhenSpaceIsFreed) {
+    spsc::RingBuffer rb(16);
+    spsc::EventNotifier notifier;
+    ASSERT_TRUE(notifier.open());
+
+    EXPECT_FALSE(rb.armWritable(notifier));
+    ASSERT_TRUE(rb.writeAll(std::uint64_t{1}, std::uint64_t{2}));
+    ASSERT_TRUE(rb.armWritable(notifier));
+
+    std::uint64_t value;
+    ASSERT_TRUE(rb.readWait(value));
+    EXPECT_TRUE(isSignaled(notifier));
+}
+
+TEST(EventNotifierTest, DisarmWhileNotifying) {
+    spsc::RingBuffer rb(64);
+    spsc::EventNotifier notifier;
+    ASSERT_TRUE(notifier.open());
+    std::atomic<bool> done{false};
+
+    // The ring buffer stays empty, so each notification examines the notifier and leaves it armed
+    std::thread producer([&] {
+        while (!done.load(std::memory_order_relaxed)) {
+            rb.notifyConsumer();
+        }
+    });
+
+    for (int i = 0; i < 100'000; ++i) {
+        ASSERT_TRUE(rb.armReadable(notifier));
+        rb.disarm(notifier);
+    }
+
+    done.store(true, std::memory_order_relaxed);
+    producer.join();
+
+    // No notification may have left the disarmed notifier in place
+    ASSERT_TRUE(rb.write(std::uint32_t{1}));
+    rb.notifyConsumer();
+    EXPECT_FALSE(isSignaled(notifier));
+}
+
+TEST(EventNotifierTest, ReactorConsumer) {
+    spsc::RingBuffer rb(256);
+    spsc::EventNotifier notifier;
+    ASSERT_TRUE(notifier.open());
+    constexpr std::uint64_t count = 100'000;
+
+    ASSERT_TRUE(rb.armReadable(notifier));
+    std::thread producer([&] {
+        // Notifying every 16 values never leaves a full buffer unannounced
+        for (std::uint64_t i = 0; i < count; ++i) {
+            while (!rb.write(i)) {
+                std::this_thread::yield();
+            }
+            if (i % 16 == 15 || i + 1 == count) {
+                rb.notifyConsumer();
+            }
+        }
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < count) {
+        ASSERT_TRUE(isSignaled(notifier, 10'000));
+        notifier.clear();
+        do {
+            std::uint64_t value;
+            while (rb.read(value)) {
+                ASSERT_EQ(value, expected);
+                ++expected;
+            }
+        } while (expected < count && !rb.armReadable(notifier));
+    }
+
+    producer.join();
+    rb.disarm(notifier);
+}
+
+#endif
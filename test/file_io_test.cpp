@@ -0,0 +1,123 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/FileIO.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <numeric>
+#include <span>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+class FileIOTest : public ::testing::Test {
+  protected:
+    void SetUp() override { ASSERT_EQ(::pipe(fds), 0); }
+
+    void TearDown() override {
+        for (auto fd : fds) {
+            if (fd != -1) {
+                ::close(fd);
+            }
+        }
+    }
+
+    spsc::RingBuffer rb{16};
+    int fds[2]{-1, -1};
+};
+
+} // namespace
+
+TEST_F(FileIOTest, ReadFromFileFillsBothRegions) {
+    // Move both positions so the free space wraps around the end of the buffer
+    const std::array<unsigned char, 12> scratch{};
+    ASSERT_EQ(rb.write(std::span<const unsigned char>{scratch}), scratch.size());
+    ASSERT_EQ(rb.skip(1, scratch.size()), scratch.size());
+
+    std::array<unsigned char, 20> data;
+    std::iota(data.begin(), data.end(), 0);
+    ASSERT_EQ(::write(fds[1], data.data(), data.size()), static_cast<::ssize_t>(data.size()));
+
+    EXPECT_EQ(spsc::io::readFromFile(rb, fds[0]), 16);
+    EXPECT_EQ(rb.freeSpace(), 0);
+
+    // A full ring buffer is distinguished from end of file
+    errno = 0;
+    EXPECT_EQ(spsc::io::readFromFile(rb, fds[0]), -1);
+    EXPECT_EQ(errno, ENOBUFS);
+
+    std::array<unsigned char, 16> out{};
+    ASSERT_EQ(rb.read(std::span<unsigned char>{out}), out.size());
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin()));
+
+    ::close(fds[1]);
+    fds[1] = -1;
+    EXPECT_EQ(spsc::io::readFromFile(rb, fds[0]), 4);
+    EXPECT_EQ(spsc::io::readFromFile(rb, fds[0]), 0);
+    EXPECT_EQ(rb.availableBytes(), 4);
+}
+
+TEST_F(FileIOTest, WriteToFileDrainsBothRegions) {
+    const std::array<unsigned char, 12> scratch{};
+    ASSERT_EQ(rb.write(std::span<const unsigned char>{scratch}), scratch.size());
+    ASSERT_EQ(rb.skip(1, scratch.size()), scratch.size());
+
+    std::array<unsigned char, 10> data;
+    std::iota(data.begin(), data.end(), 1);
+    ASSERT_EQ(rb.write(std::span<const unsigned char>{data}), data.size());
+
+    EXPECT_EQ(spsc::io::writeToFile(rb, fds[1]), 10);
+    EXPECT_TRUE(rb.isEmpty());
+    EXPECT_EQ(spsc::io::writeToFile(rb, fds[1]), 0);
+
+    std::array<unsigned char, 10> out{};
+    ASSERT_EQ(::read(fds[0], out.data(), out.size()), static_cast<::ssize_t>(out.size()));
+    EXPECT_EQ(out, data);
+
+    EXPECT_EQ(spsc::io::writeToFile(rb, -1), 0);
+    ASSERT_TRUE(rb.write(std::uint8_t{1}));
+    EXPECT_EQ(spsc::io::writeToFile(rb, -1), -1);
+    EXPECT_EQ(rb.availableBytes(), 1);
+}
+
+TEST_F(FileIOTest, SocketTransfer) {
+    int sockets[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+    std::array<std::uint32_t, 3> data{1, 2, 3};
+    ASSERT_EQ(rb.write(std::span<const std::uint32_t>{data}), data.size());
+    EXPECT_EQ(spsc::io::sendToSocket(rb, sockets[0]), 12);
+
+    spsc::RingBuffer received{64};
+    EXPECT_EQ(spsc::io::receiveFromSocket(received, sockets[1]), 12);
+    EXPECT_EQ(spsc::io::receiveFromSocket(received, sockets[1], MSG_DONTWAIT), -1);
+
+    std::array<std::uint32_t, 3> out{};
+    ASSERT_EQ(received.read(std::span<std::uint32_t>{out}), out.size());
+    EXPECT_EQ(out, data);
+
+    spsc::RingBuffer full{16};
+    ASSERT_TRUE(full.writeAll(std::uint64_t{1}, std::uint64_t{2}));
+    errno = 0;
+    EXPECT_EQ(spsc::io::receiveFromSocket(full, sockets[1]), -1);
+    EXPECT_EQ(errno, ENOBUFS);
+
+    ::close(sockets[0]);
+    EXPECT_EQ(spsc::io::receiveFromSocket(received, sockets[1]), 0);
+    ::close(sockets[1]);
+}
+
+#endif
@@ -0,0 +1,193 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/MessageRing.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+bool writeString(spsc::MessageRing &ring, std::string_view s) { return ring.tryWriteMessage(s.data(), s.size()); }
+
+std::string_view asString(std::span<const unsigned char> payload) {
+    return {reinterpret_cast<const char *>(payload.data()), payload.size()};
+}
+
+} // namespace
+
+TEST(MessageRingTest, Allocation) {
+    spsc::MessageRing ring;
+    EXPECT_FALSE(ring);
+    EXPECT_EQ(ring.maxMessageSize(), 0);
+    EXPECT_FALSE(writeString(ring, "x"));
+    EXPECT_FALSE(ring.tryReadMessage());
+
+    EXPECT_FALSE(ring.allocate(spsc::MessageRing::minCapacity - 1));
+    ASSERT_TRUE(ring.allocate(100));
+    EXPECT_EQ(ring.capacity(), 128);
+    EXPECT_EQ(ring.maxMessageSize(), 64 - spsc::MessageRing::headerSize);
+    EXPECT_TRUE(ring.isEmpty());
+
+    EXPECT_THROW(spsc::MessageRing(1), std::invalid_argument);
+}
+
+TEST(MessageRingTest, WriteAndReadMessages) {
+    spsc::MessageRing ring(64);
+
+    ASSERT_TRUE(writeString(ring, "hello"));
+    ASSERT_TRUE(writeString(ring, ""));
+    ASSERT_TRUE(writeString(ring, "world!"));
+    EXPECT_FALSE(ring.isEmpty());
+
+    auto message = ring.tryReadMessage();
+    ASSERT_TRUE(message);
+    EXPECT_EQ(asString(*message), "hello");
+    message = ring.tryReadMessage();
+    ASSERT_TRUE(message);
+    EXPECT_TRUE(message->empty());
+    message = ring.tryReadMessage();
+    ASSERT_TRUE(message);
+    EXPECT_EQ(asString(*message), "world!");
+    EXPECT_FALSE(ring.tryReadMessage());
+    EXPECT_TRUE(ring.isEmpty());
+
+    ring.releaseMessages();
+    EXPECT_TRUE(ring.isEmpty());
+}
+
+TEST(MessageRingTest, ReleasedSpaceIsReused) {
+    spsc::MessageRing ring(32);
+    const std::string_view payload = "0123456789";
+
+    ASSERT_TRUE(writeString(ring, payload));
+    ASSERT_TRUE(writeString(ring, payload));
+    EXPECT_FALSE(writeString(ring, payload));
+
+    ASSERT_TRUE(ring.tryReadMessage());
+    EXPECT_FALSE(writeString(ring, payload));
+    ring.releaseMessages();
+    EXPECT_TRUE(writeString(ring, payload));
+}
+
+TEST(MessageRingTest, MessagesNeverWrap) {
+    spsc::MessageRing ring(64);
+
+    // Leave the write position 16 bytes before the end of the buffer
+    ASSERT_TRUE(writeString(ring, std::string(20, 'a')));
+    ASSERT_TRUE(writeString(ring, std::string(20, 'a')));
+    ASSERT_TRUE(ring.tryReadMessage());
+    ASSERT_TRUE(ring.tryReadMessage());
+    ring.releaseMessages();
+
+    const std::string payload(24, 'b');
+    ASSERT_TRUE(writeString(ring, payload));
+
+    auto message = ring.tryReadMessage();
+    ASSERT_TRUE(message);
+    EXPECT_EQ(asString(*message), payload);
+
+    // The next record follows the message directly only if the message was moved to the start of the buffer
+    auto next = ring.tryReserveMessage(0);
+    ASSERT_TRUE(next);
+    EXPECT_EQ(next->data(), message->data() + payload.size() + spsc::MessageRing::headerSize);
+    ring.cancelMessages();
+    EXPECT_FALSE(ring.tryReadMessage());
+    ring.releaseMessages();
+    EXPECT_TRUE(ring.isEmpty());
+}
+
+TEST(MessageRingTest, OversizedMessagesAreRejected) {
+    spsc::MessageRing ring(64);
+    EXPECT_FALSE(ring.tryReserveMessage(ring.maxMessageSize() + 1));
+    EXPECT_TRUE(ring.tryReserveMessage(ring.maxMessageSize()));
+}
+
+TEST(MessageRingTest, ReservedMessagesAreCommittedTogether) {
+    spsc::MessageRing ring(64);
+
+    auto first = ring.tryReserveMessage(3);
+    ASSERT_TRUE(first);
+    std::memcpy(first->data(), "abc", 3);
+    auto second = ring.tryReserveMessage(2);
+    ASSERT_TRUE(second);
+    std::memcpy(second->data(), "de", 2);
+    EXPECT_FALSE(ring.tryReadMessage());
+
+    ring.commitMessages();
+    EXPECT_EQ(asString(*ring.tryReadMessage()), "abc");
+    EXPECT_EQ(asString(*ring.tryReadMessage()), "de");
+
+    ASSERT_TRUE(ring.tryReserveMessage(8));
+    ring.cancelMessages();
+    ring.commitMessages();
+    EXPECT_FALSE(ring.tryReadMessage());
+}
+
+TEST(MessageRingTest, MirroredMessagesUseWholeBuffer) {
+    spsc::MessageRing ring;
+    if (!ring.allocate(64, {.mirrored = true})) {
+        GTEST_SKIP() << "Mirrored allocation not supported";
+    }
+    EXPECT_EQ(ring.maxMessageSize(), ring.capacity() - spsc::MessageRing::headerSize);
+
+    ASSERT_TRUE(writeString(ring, "x"));
+    ASSERT_TRUE(ring.tryReadMessage());
+    ring.releaseMessages();
+
+    const std::vector<unsigned char> payload(ring.maxMessageSize(), 0x5a);
+    ASSERT_TRUE(ring.tryWriteMessage(std::span<const unsigned char>{payload}));
+    auto message = ring.tryReadMessage();
+    ASSERT_TRUE(message);
+    EXPECT_TRUE(std::equal(message->begin(), message->end(), payload.begin(), payload.end()));
+}
+
+TEST(MessageRingTest, ProducerConsumer) {
+    spsc::MessageRing ring(1024);
+    constexpr std::uint32_t count = 100'000;
+
+    // Message n holds n % 61 copies of n
+    std::thread producer([&] {
+        std::vector<std::uint32_t> payload;
+        for (std::uint32_t n = 0; n < count; ++n) {
+            payload.assign(n % 61, n);
+            while (!ring.tryWriteMessage(std::span<const std::uint32_t>{payload})) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::uint32_t expected = 0;
+    while (expected < count) {
+        auto message = ring.tryReadMessage();
+        if (!message) {
+            ring.releaseMessages();
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(message->size(), (expected % 61) * sizeof expected);
+        for (std::size_t i = 0; i < message->size(); i += sizeof expected) {
+            std::uint32_t value;
+            std::memcpy(&value, message->data() + i, sizeof value);
+            ASSERT_EQ(value, expected);
+        }
+        ++expected;
+    }
+
+    producer.join();
+    ring.releaseMessages();
+    EXPECT_TRUE(ring.isEmpty());
+}
@@ -0,0 +1,195 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "mpsc/RingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+bool writeString(mpsc::RingBuffer &ring, std::string_view s) { return ring.write(s.data(), s.size()); }
+
+std::string_view asString(std::span<const unsigned char> payload) {
+    return {reinterpret_cast<const char *>(payload.data()), payload.size()};
+}
+
+} // namespace
+
+TEST(MPSCRingBufferTest, Allocation) {
+    mpsc::RingBuffer ring;
+    EXPECT_FALSE(ring);
+    EXPECT_EQ(ring.maxRecordSize(), 0);
+    EXPECT_FALSE(writeString(ring, "x"));
+    EXPECT_FALSE(ring.readRecord());
+
+    EXPECT_FALSE(ring.allocate(mpsc::RingBuffer::minCapacity - 1));
+    ASSERT_TRUE(ring.allocate(100));
+    EXPECT_EQ(ring.capacity(), 128);
+    EXPECT_EQ(ring.maxRecordSize(), 64 - mpsc::RingBuffer::headerSize);
+    EXPECT_TRUE(ring.isEmpty());
+
+    EXPECT_THROW(mpsc::RingBuffer(1), std::invalid_argument);
+
+    mpsc::RingBuffer moved(std::move(ring));
+    EXPECT_FALSE(ring);
+    EXPECT_EQ(moved.capacity(), 128);
+    EXPECT_TRUE(writeString(moved, "x"));
+}
+
+TEST(MPSCRingBufferTest, WriteAndReadRecords) {
+    mpsc::RingBuffer ring(64);
+
+    ASSERT_TRUE(writeString(ring, "hello"));
+    ASSERT_TRUE(writeString(ring, ""));
+    ASSERT_TRUE(ring.write(std::uint32_t{42}));
+    EXPECT_FALSE(ring.isEmpty());
+
+    auto record = ring.readRecord();
+    ASSERT_TRUE(record);
+    EXPECT_EQ(asString(*record), "hello");
+    record = ring.readRecord();
+    ASSERT_TRUE(record);
+    EXPECT_TRUE(record->empty());
+    record = ring.readRecord();
+    ASSERT_TRUE(record);
+    ASSERT_EQ(record->size(), sizeof(std::uint32_t));
+    std::uint32_t value;
+    std::memcpy(&value, record->data(), sizeof value);
+    EXPECT_EQ(value, 42);
+    EXPECT_FALSE(ring.readRecord());
+    EXPECT_TRUE(ring.isEmpty());
+
+    ring.commitRead();
+    EXPECT_TRUE(ring.isEmpty());
+}
+
+TEST(MPSCRingBufferTest, RecordsAreVisibleOnlyInReservationOrder) {
+    mpsc::RingBuffer ring(64);
+
+    auto first = ring.reserve(3);
+    ASSERT_TRUE(first);
+    auto second = ring.reserve(2);
+    ASSERT_TRUE(second);
+    std::memcpy(second->data(), "de", 2);
+    ring.commit(*second);
+
+    // The second record is complete but must wait for the first
+    EXPECT_FALSE(ring.readRecord());
+    EXPECT_FALSE(ring.isEmpty());
+
+    std::memcpy(first->data(), "abc", 3);
+    ring.commit(*first);
+    EXPECT_EQ(asString(*ring.readRecord()), "abc");
+    EXPECT_EQ(asString(*ring.readRecord()), "de");
+    EXPECT_FALSE(ring.readRecord());
+}
+
+TEST(MPSCRingBufferTest, ReleasedSpaceIsReused) {
+    mpsc::RingBuffer ring(32);
+
+    ASSERT_TRUE(writeString(ring, "01234567"));
+    ASSERT_TRUE(writeString(ring, "89abcdef"));
+    EXPECT_FALSE(writeString(ring, "01234567"));
+    EXPECT_FALSE(ring.reserve(ring.maxRecordSize() + 1));
+
+    // A full buffer wraps exactly, so the oldest record must not be read twice
+    EXPECT_EQ(asString(*ring.readRecord()), "01234567");
+    EXPECT_EQ(asString(*ring.readRecord()), "89abcdef");
+    EXPECT_FALSE(ring.readRecord());
+    EXPECT_FALSE(writeString(ring, "01234567"));
+    ring.commitRead();
+    EXPECT_TRUE(writeString(ring, "01234567"));
+    EXPECT_EQ(asString(*ring.readRecord()), "01234567");
+}
+
+TEST(MPSCRingBufferTest, RecordsNeverWrap) {
+    mpsc::RingBuffer ring(64);
+
+    // Leave the reservation position 16 bytes before the end of the buffer
+    ASSERT_TRUE(writeString(ring, std::string(16, 'a')));
+    ASSERT_TRUE(writeString(ring, std::string(16, 'a')));
+    ASSERT_TRUE(ring.readRecord());
+    ASSERT_TRUE(ring.readRecord());
+    ring.commitRead();
+
+    for (auto i = 0; i < 3; ++i) {
+        const std::string payload(20, static_cast<char>('b' + i));
+        ASSERT_TRUE(writeString(ring, payload));
+
+        auto record = ring.readRecord();
+        ASSERT_TRUE(record);
+        EXPECT_EQ(asString(*record), payload);
+        ring.commitRead();
+        EXPECT_TRUE(ring.isEmpty());
+    }
+}
+
+TEST(MPSCRingBufferTest, MultipleProducers) {
+    mpsc::RingBuffer ring(1024);
+    constexpr std::uint32_t producerCount = 4;
+    constexpr std::uint32_t count = 50'000;
+
+    struct Item {
+        std::uint32_t producer;
+        std::uint32_t sequence;
+    };
+
+    // Records hold between one and four copies of an item
+    std::vector<std::thread> producers;
+    for (std::uint32_t p = 0; p < producerCount; ++p) {
+        producers.emplace_back([&ring, p] {
+            std::array<Item, 4> items;
+            for (std::uint32_t n = 0; n < count; ++n) {
+                items.fill({p, n});
+                const auto payload = std::span<const Item>{items}.first(1 + n % items.size());
+                while (!ring.write(payload)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<std::uint32_t, producerCount> expected{};
+    for (std::uint32_t received = 0; received < producerCount * count;) {
+        auto record = ring.readRecord();
+        if (!record) {
+            ring.commitRead();
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(record->size() % sizeof(Item), 0);
+        Item item;
+        std::memcpy(&item, record->data(), sizeof item);
+        ASSERT_LT(item.producer, producerCount);
+        ASSERT_EQ(item.sequence, expected[item.producer]);
+        ASSERT_EQ(record->size(), (1 + item.sequence % 4) * sizeof item);
+        for (std::size_t i = sizeof item; i < record->size(); i += sizeof item) {
+            Item copy;
+            std::memcpy(&copy, record->data() + i, sizeof copy);
+            ASSERT_EQ(copy.producer, item.producer);
+            ASSERT_EQ(copy.sequence, item.sequence);
+        }
+        ++expected[item.producer];
+        ++received;
+    }
+
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    ring.commitRead();
+    EXPECT_TRUE(ring.isEmpty());
+}
@@ -0,0 +1,157 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/OverwritingRingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(OverwritingRingBufferTest, Allocation) {
+    spsc::OverwritingRingBuffer ring;
+    EXPECT_FALSE(ring);
+    EXPECT_EQ(ring.write(1), false);
+    EXPECT_EQ(ring.availableBytes(), 0);
+
+    ASSERT_TRUE(ring.allocate(100));
+    EXPECT_EQ(ring.capacity(), 128);
+    EXPECT_FALSE(ring.allocate(1));
+
+    EXPECT_THROW(spsc::OverwritingRingBuffer(1), std::invalid_argument);
+}
+
+TEST(OverwritingRingBufferTest, ReadsWithoutOverrun) {
+    spsc::OverwritingRingBuffer ring(16);
+    ASSERT_TRUE(ring.write(std::uint32_t{1}));
+    ASSERT_TRUE(ring.write(std::uint32_t{2}));
+    EXPECT_EQ(ring.availableBytes(), 8);
+
+    std::array<std::uint32_t, 2> out{};
+    ASSERT_EQ(ring.read(std::span<std::uint32_t>{out}), out.size());
+    EXPECT_EQ(out, (std::array<std::uint32_t, 2>{1, 2}));
+    EXPECT_EQ(ring.overrunCount(), 0);
+    EXPECT_EQ(ring.missedBytes(), 0);
+    EXPECT_EQ(ring.overwrittenBytes(), 0);
+}
+
+TEST(OverwritingRingBufferTest, OldestDataIsOverwritten) {
+    spsc::OverwritingRingBuffer ring(16);
+
+    // The producer never runs out of space
+    for (std::uint32_t i = 0; i < 10; ++i) {
+        ASSERT_TRUE(ring.write(i));
+    }
+    EXPECT_EQ(ring.overwrittenBytes(), 24);
+
+    EXPECT_EQ(ring.availableBytes(), 16);
+    EXPECT_EQ(ring.missedBytes(), 24);
+    EXPECT_EQ(ring.overrunCount(), 1);
+
+    std::array<std::uint32_t, 4> out{};
+    ASSERT_EQ(ring.read(std::span<std::uint32_t>{out}), out.size());
+    EXPECT_EQ(out, (std::array<std::uint32_t, 4>{6, 7, 8, 9}));
+
+    // Lagging again is a new overrun
+    for (std::uint32_t i = 10; i < 15; ++i) {
+        ASSERT_TRUE(ring.write(i));
+    }
+    EXPECT_EQ(ring.overwrittenBytes(), 28);
+    std::uint32_t value;
+    ASSERT_TRUE(ring.read(value));
+    EXPECT_EQ(value, 11);
+    EXPECT_EQ(ring.overrunCount(), 2);
+    EXPECT_EQ(ring.missedBytes(), 28);
+}
+
+TEST(OverwritingRingBufferTest, OversizedWriteKeepsNewestItems) {
+    spsc::OverwritingRingBuffer ring(16);
+
+    std::array<std::uint32_t, 6> in;
+    std::iota(in.begin(), in.end(), 0);
+    EXPECT_EQ(ring.write(std::span<const std::uint32_t>{in}), 4);
+
+    std::array<std::uint32_t, 4> out{};
+    ASSERT_EQ(ring.read(std::span<std::uint32_t>{out}), out.size());
+    EXPECT_EQ(out, (std::array<std::uint32_t, 4>{2, 3, 4, 5}));
+
+    const std::array<unsigned char, 17> tooLarge{};
+    EXPECT_EQ(ring.write(tooLarge.data(), tooLarge.size(), 1), 0);
+}
+
+TEST(OverwritingRingBufferTest, ProducerNeverStalls) {
+    spsc::OverwritingRingBuffer ring(256);
+    constexpr std::uint64_t count = 1'000'000;
+
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            ring.write(i);
+        }
+    });
+
+    // Every value read is intact and values only move forward
+    bool ok = true;
+    std::uint64_t valuesRead = 0;
+    std::uint64_t last = 0;
+    for (;;) {
+        std::uint64_t value;
+        if (!ring.read(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if ((valuesRead > 0 && value <= last) || value != valuesRead + ring.missedBytes() / sizeof value) {
+            ok = false;
+            break;
+        }
+        ++valuesRead;
+        last = value;
+        if (value == count - 1) {
+            break;
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(valuesRead + ring.missedBytes() / sizeof(std::uint64_t), count);
+}
+
+TEST(OverwritingRingBufferTest, LargeReadsWhileOverrun) {
+    spsc::OverwritingRingBuffer ring(64);
+    constexpr std::uint64_t count = 2'000'000;
+
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            ring.write(i);
+        }
+    });
+
+    // Reads far larger than the capacity only return one intact run of consecutive values
+    bool ok = true;
+    std::vector<std::uint64_t> values(1 << 17);
+    std::uint64_t readsCompleted = 0;
+    std::uint64_t last = 0;
+    while (ok && last != count - 1) {
+        const auto itemsRead = ring.read(std::span{values}, true);
+        if (itemsRead == 0) {
+            continue;
+        }
+        ok = itemsRead <= ring.capacity() / sizeof(std::uint64_t) && (readsCompleted == 0 || values[0] > last);
+        for (std::size_t i = 1; ok && i < itemsRead; ++i) {
+            ok = values[i] == values[i - 1] + 1;
+        }
+        ++readsCompleted;
+        last = values[itemsRead - 1];
+    }
+
+    producer.join();
+    EXPECT_TRUE(ok);
+}
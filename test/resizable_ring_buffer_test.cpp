@@ -0,0 +1,156 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/ResizableRingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+TEST(ResizableRingBufferTest, Allocation) {
+    spsc::ResizableRingBuffer rb;
+    EXPECT_FALSE(rb);
+    EXPECT_EQ(rb.capacity(), 0);
+    EXPECT_TRUE(rb.isEmpty());
+    EXPECT_FALSE(rb.write(std::uint32_t{1}));
+    EXPECT_FALSE(rb.resize(64));
+
+    EXPECT_FALSE(rb.allocate(64, 32));
+    EXPECT_FALSE(rb.allocate(spsc::ResizableRingBuffer::minCapacity - 1));
+    ASSERT_TRUE(rb.allocate(100, 1000));
+    EXPECT_EQ(rb.capacity(), 128);
+    EXPECT_EQ(rb.capacityLimit(), 1024);
+
+    EXPECT_THROW(spsc::ResizableRingBuffer(64, 32), std::invalid_argument);
+}
+
+TEST(ResizableRingBufferTest, GrowsWhenFull) {
+    spsc::ResizableRingBuffer rb(16, 256);
+
+    for (std::uint32_t i = 0; i < 32; ++i) {
+        ASSERT_TRUE(rb.write(i));
+    }
+    EXPECT_EQ(rb.capacity(), 128);
+
+    // Every segment is now full, and the last one is at the limit
+    const std::array<std::uint32_t, 64> large{};
+    EXPECT_FALSE(rb.write(large.data(), 512));
+    EXPECT_TRUE(rb.write(large.data(), 256));
+    EXPECT_EQ(rb.capacity(), 256);
+    EXPECT_FALSE(rb.write(std::uint32_t{0}));
+
+    for (std::uint32_t i = 0; i < 32; ++i) {
+        std::uint32_t value;
+        ASSERT_TRUE(rb.read(value));
+        EXPECT_EQ(value, i);
+    }
+    std::array<std::uint32_t, 64> out{};
+    EXPECT_EQ(rb.read(out.data(), 512), 256);
+    EXPECT_TRUE(rb.isEmpty());
+}
+
+TEST(ResizableRingBufferTest, ReadSpansSegments) {
+    spsc::ResizableRingBuffer rb(16);
+
+    const std::array<unsigned char, 8> first{1, 2, 3, 4, 5, 6, 7, 8};
+    const std::array<unsigned char, 8> second{9, 10, 11, 12, 13, 14, 15, 16};
+    ASSERT_TRUE(rb.write(first.data(), first.size()));
+    ASSERT_TRUE(rb.resize(64));
+    ASSERT_TRUE(rb.write(second.data(), second.size()));
+    EXPECT_FALSE(rb.isEmpty());
+
+    std::array<unsigned char, 16> out{};
+    ASSERT_EQ(rb.read(out.data(), out.size()), 16);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        EXPECT_EQ(out[i], i + 1);
+    }
+    EXPECT_TRUE(rb.isEmpty());
+}
+
+TEST(ResizableRingBufferTest, ShrinksAfterLightUse) {
+    spsc::ResizableRingBuffer rb(16);
+
+    ASSERT_TRUE(rb.resize(4096));
+    EXPECT_EQ(rb.capacity(), 4096);
+    // Resizing to the same capacity keeps the current segment
+    EXPECT_TRUE(rb.resize(4000));
+
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(rb.write(i));
+        std::uint32_t value;
+        ASSERT_TRUE(rb.read(value));
+        ASSERT_EQ(value, i);
+    }
+
+    ASSERT_TRUE(rb.trim());
+    EXPECT_LT(rb.capacity(), 4096);
+    EXPECT_GE(rb.capacity(), 16);
+    EXPECT_FALSE(rb.trim());
+
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        ASSERT_TRUE(rb.write(i));
+    }
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        std::uint32_t value;
+        ASSERT_TRUE(rb.read(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+TEST(ResizableRingBufferTest, Move) {
+    spsc::ResizableRingBuffer rb(16);
+    ASSERT_TRUE(rb.write(std::uint32_t{7}));
+    ASSERT_TRUE(rb.resize(32));
+    ASSERT_TRUE(rb.write(std::uint32_t{8}));
+
+    spsc::ResizableRingBuffer moved(std::move(rb));
+    EXPECT_FALSE(rb);
+    std::uint32_t value;
+    ASSERT_TRUE(moved.read(value));
+    EXPECT_EQ(value, 7);
+
+    rb = std::move(moved);
+    ASSERT_TRUE(rb.read(value));
+    EXPECT_EQ(value, 8);
+    EXPECT_TRUE(rb.isEmpty());
+}
+
+TEST(ResizableRingBufferTest, ProducerConsumer) {
+    spsc::ResizableRingBuffer rb(16, 1024);
+    constexpr std::uint64_t count = 100'000;
+
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            while (!rb.write(i)) {
+                std::this_thread::yield();
+            }
+            // Cycle between capacities while the consumer is reading
+            if (i % 10'000 == 9'999) {
+                rb.trim();
+            }
+        }
+    });
+
+    std::uint64_t expected = 0;
+    while (expected < count) {
+        std::uint64_t value;
+        if (rb.read(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(rb.isEmpty());
+}
@@ -0,0 +1,170 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/RingSet.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Consumes everything offered and records the index of each ring buffer visited.
+struct Recorder {
+    std::vector<std::size_t> visits;
+
+    std::size_t operator()(std::size_t index, std::span<const std::byte> data) {
+        if (visits.empty() || visits.back() != index) {
+            visits.push_back(index);
+        }
+        return data.size();
+    }
+};
+
+} // namespace
+
+TEST(RingSetTest, Allocation) {
+    spsc::RingSet set;
+    EXPECT_FALSE(set);
+    EXPECT_EQ(set.ringCount(), 0);
+    EXPECT_EQ(set.poll(Recorder{}), 0);
+
+    EXPECT_FALSE(set.allocate(0, 64));
+    EXPECT_FALSE(set.allocate(4, 0));
+    ASSERT_TRUE(set.allocate(100, 60));
+    EXPECT_EQ(set.ringCount(), 100);
+    EXPECT_EQ(set.producer(99).capacity(), 64);
+    EXPECT_FALSE(set.hasMarked());
+
+    EXPECT_THROW(spsc::RingSet(0, 64), std::invalid_argument);
+}
+
+TEST(RingSetTest, VisitsOnlyMarkedRings) {
+    spsc::RingSet set(8, 64);
+
+    ASSERT_TRUE(set.producer(5).write(std::uint32_t{5}));
+    ASSERT_TRUE(set.producer(3).write(std::uint32_t{3}));
+    // A failed write does not mark the ring
+    const std::array<std::byte, 128> large{};
+    EXPECT_EQ(set.producer(6).write(std::span<const std::byte>{large}, false), 0);
+    EXPECT_TRUE(set.hasMarked());
+
+    Recorder recorder;
+    EXPECT_EQ(set.poll(recorder), 8);
+    EXPECT_EQ(recorder.visits, (std::vector<std::size_t>{3, 5}));
+    EXPECT_FALSE(set.hasMarked());
+
+    // Rings left empty are armed again and are marked only once
+    recorder.visits.clear();
+    ASSERT_TRUE(set.producer(3).write(std::uint32_t{3}));
+    ASSERT_TRUE(set.producer(3).write(std::uint32_t{3}));
+    EXPECT_EQ(set.poll(recorder), 8);
+    EXPECT_EQ(recorder.visits, (std::vector<std::size_t>{3}));
+    EXPECT_EQ(set.poll(recorder), 0);
+}
+
+TEST(RingSetTest, CommittedWritesMarkRings) {
+    spsc::RingSet set(4, 64);
+
+    auto producer = set.producer(2);
+    const auto [front, back] = producer.writeVector(8);
+    ASSERT_GE(front.size() + back.size(), 8);
+    producer.commitWrite(0);
+    EXPECT_FALSE(set.hasMarked());
+    producer.commitWrite(8);
+    EXPECT_TRUE(set.hasMarked());
+
+    EXPECT_EQ(set.producer(1).produce([](std::span<std::byte> space) { return space.size() < 4 ? 0 : 4; }), 4);
+
+    Recorder recorder;
+    EXPECT_EQ(set.poll(recorder), 12);
+    EXPECT_EQ(recorder.visits, (std::vector<std::size_t>{1, 2}));
+}
+
+TEST(RingSetTest, BudgetLimitsEachVisit) {
+    spsc::RingSet set(2, 64);
+    const std::array<unsigned char, 32> data{};
+    for (std::size_t i = 0; i < set.ringCount(); ++i) {
+        ASSERT_EQ(set.producer(i).write(std::span<const unsigned char>{data}), data.size());
+    }
+
+    // Rings with data left remain marked without further notification
+    for (auto pass = 0; pass < 4; ++pass) {
+        Recorder recorder;
+        EXPECT_EQ(set.poll(recorder, 8), 16);
+        EXPECT_EQ(recorder.visits.size(), 2);
+    }
+    EXPECT_EQ(set.poll(Recorder{}, 8), 0);
+    EXPECT_FALSE(set.hasMarked());
+}
+
+TEST(RingSetTest, VisitsBeginAfterPreviousVisit) {
+    spsc::RingSet set(3, 64);
+
+    ASSERT_TRUE(set.producer(1).write(std::uint32_t{1}));
+    Recorder recorder;
+    set.poll(recorder);
+
+    for (const std::size_t i : {0, 2}) {
+        ASSERT_TRUE(set.producer(i).write(std::uint32_t{1}));
+    }
+    recorder.visits.clear();
+    set.poll(recorder);
+    EXPECT_EQ(recorder.visits, (std::vector<std::size_t>{2, 0}));
+}
+
+TEST(RingSetTest, ManyProducers) {
+    spsc::RingSet set(70, 256);
+    constexpr std::array<std::size_t, 4> active{0, 63, 64, 69};
+    constexpr std::uint64_t count = 20'000;
+
+    std::vector<std::thread> producers;
+    for (const auto index : active) {
+        producers.emplace_back([&set, index] {
+            auto producer = set.producer(index);
+            for (std::uint64_t i = 0; i < count; ++i) {
+                while (!producer.write(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<std::uint64_t> expected(set.ringCount(), 0);
+    std::uint64_t received = 0;
+    auto failed = false;
+    while (received < active.size() * count && !failed) {
+        const auto consumed = set.poll([&](std::size_t index, std::span<const std::byte> data) {
+            const auto whole = data.size() / sizeof(std::uint64_t);
+            for (std::size_t i = 0; i < whole; ++i) {
+                std::uint64_t value;
+                std::memcpy(&value, data.data() + i * sizeof value, sizeof value);
+                failed |= value != expected[index]++;
+            }
+            received += whole;
+            return whole * sizeof(std::uint64_t);
+        });
+        if (consumed == 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(failed);
+    for (const auto index : active) {
+        EXPECT_EQ(expected[index], count);
+    }
+}
@@ -0,0 +1,245 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/SharedRingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__) || defined(__APPLE__)
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+using Role = spsc::SharedRingBuffer::Role;
+
+class SharedRingBufferTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        name = "/cxxrb-test-" + std::to_string(::getpid());
+        spsc::SharedRingBuffer::remove(name.c_str());
+    }
+
+    void TearDown() override { spsc::SharedRingBuffer::remove(name.c_str()); }
+
+    std::string name;
+};
+
+} // namespace
+
+// Awaiting and event notifiers would publish process-local addresses in shared memory.
+template <typename R>
+concept CanAwait = requires(R &rb) { rb.readable(); };
+static_assert(!CanAwait<spsc::SharedRingBuffer::Ring> && CanAwait<spsc::RingBuffer>);
+
+TEST_F(SharedRingBufferTest, CreateAndOpen) {
+    spsc::SharedRingBuffer producer;
+    EXPECT_FALSE(producer);
+    EXPECT_FALSE(producer.open(name.c_str(), Role::producer));
+
+    ASSERT_TRUE(producer.create(name.c_str(), 1000, Role::producer));
+    EXPECT_EQ(producer->capacity(), 1024);
+    EXPECT_EQ(producer.role(), Role::producer);
+    EXPECT_FALSE(producer.isPeerAlive());
+
+    // The object already exists
+    spsc::SharedRingBuffer other;
+    EXPECT_FALSE(other.create(name.c_str(), 1000, Role::producer));
+
+    spsc::SharedRingBuffer consumer;
+    ASSERT_TRUE(consumer.open(name.c_str(), Role::consumer));
+    EXPECT_EQ(consumer->capacity(), 1024);
+    EXPECT_TRUE(producer.isPeerAlive());
+    EXPECT_TRUE(consumer.isPeerAlive());
+
+    consumer.close();
+    EXPECT_FALSE(consumer);
+    EXPECT_FALSE(producer.isPeerAlive());
+}
+
+TEST_F(SharedRingBufferTest, MappingsArePositionIndependent) {
+    spsc::SharedRingBuffer producer;
+    ASSERT_TRUE(producer.create(name.c_str(), 64, Role::producer));
+    spsc::SharedRingBuffer consumer;
+    ASSERT_TRUE(consumer.open(name.c_str(), Role::consumer));
+
+    // The same memory is mapped at two addresses within this process
+    EXPECT_NE(&*producer, &*consumer);
+
+    ASSERT_TRUE(producer->write(std::uint64_t{0x0123456789ABCDEF}));
+    std::uint64_t value = 0;
+    ASSERT_TRUE(consumer->read(value));
+    EXPECT_EQ(value, 0x0123456789ABCDEF);
+
+    auto [front, back] = producer->writeVector();
+    ASSERT_GE(front.size(), 1);
+    front[0] = 0x5A;
+    producer->commitWrite(1);
+    auto [readFront, readBack] = consumer->readVector();
+    ASSERT_EQ(readFront.size(), 1);
+    EXPECT_EQ(readFront[0], 0x5A);
+    EXPECT_NE(readFront.data(), front.data());
+}
+
+TEST_F(SharedRingBufferTest, FileDescriptorBacking) {
+    auto *file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    const auto fd = ::fileno(file);
+
+    spsc::SharedRingBuffer producer;
+    EXPECT_FALSE(producer.open(fd, Role::producer));
+    ASSERT_TRUE(producer.create(fd, 100, Role::producer));
+    ASSERT_TRUE(producer->write(42));
+
+    spsc::SharedRingBuffer consumer;
+    ASSERT_TRUE(consumer.open(fd, Role::consumer));
+    std::fclose(file);
+
+    int value = 0;
+    ASSERT_TRUE(consumer->read(value));
+    EXPECT_EQ(value, 42);
+}
+
+TEST_F(SharedRingBufferTest, CrossProcessTransferAndCrashDetection) {
+    spsc::SharedRingBuffer consumer;
+    ASSERT_TRUE(consumer.create(name.c_str(), 4096, Role::consumer));
+    constexpr std::uint32_t count = 100'000;
+
+    const auto child = ::fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        // Exit without detaching, as a crashed producer would
+        spsc::SharedRingBuffer producer;
+        if (!producer.open(name.c_str(), Role::producer)) {
+            std::_Exit(1);
+        }
+        for (std::uint32_t i = 0; i < count;) {
+            if (producer->write(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        std::_Exit(0);
+    }
+
+    for (std::uint32_t expected = 0; expected < count;) {
+        std::uint32_t value;
+        if (!consumer->read(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(value, expected);
+        ++expected;
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+    EXPECT_FALSE(consumer.isPeerAlive());
+
+    // A new producer may take over from the dead one
+    spsc::SharedRingBuffer producer;
+    ASSERT_TRUE(producer.open(name.c_str(), Role::producer));
+    EXPECT_TRUE(consumer.isPeerAlive());
+    EXPECT_TRUE(consumer->isEmpty());
+}
+
+TEST_F(SharedRingBufferTest, BlockingReadIsWokenByAnotherProcess) {
+    spsc::SharedRingBuffer consumer;
+    ASSERT_TRUE(consumer.create(name.c_str(), 64, Role::consumer));
+    constexpr std::uint32_t count = 10'000;
+
+    const auto child = ::fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        spsc::SharedRingBuffer producer;
+        if (!producer.open(name.c_str(), Role::producer)) {
+            std::_Exit(1);
+        }
+        for (std::uint32_t i = 0; i < count; ++i) {
+            if (!producer->writeWait(i)) {
+                std::_Exit(1);
+            }
+        }
+        producer.close();
+        std::_Exit(0);
+    }
+
+    // The default wait strategy parks, so the producer process must wake this one
+    for (std::uint32_t expected = 0; expected < count; ++expected) {
+        std::uint32_t value;
+        ASSERT_TRUE(consumer->readWait(value));
+        ASSERT_EQ(value, expected);
+    }
+
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+TEST_F(SharedRingBufferTest, RoleHeldByThisProcessIsRefused) {
+    spsc::SharedRingBuffer consumer;
+    ASSERT_TRUE(consumer.create(name.c_str(), 64, Role::consumer));
+    spsc::SharedRingBuffer producer;
+    ASSERT_TRUE(producer.open(name.c_str(), Role::producer));
+
+    spsc::SharedRingBuffer second;
+    EXPECT_FALSE(second.open(name.c_str(), Role::producer));
+    EXPECT_FALSE(second.open(name.c_str(), Role::consumer));
+
+    producer.close();
+    EXPECT_TRUE(second.open(name.c_str(), Role::producer));
+}
+
+TEST_F(SharedRingBufferTest, RoleHeldByLiveProcessIsRefused) {
+    spsc::SharedRingBuffer consumer;
+    ASSERT_TRUE(consumer.create(name.c_str(), 64, Role::consumer));
+
+    int ready[2];
+    int done[2];
+    ASSERT_EQ(::pipe(ready), 0);
+    ASSERT_EQ(::pipe(done), 0);
+
+    const auto child = ::fork();
+    ASSERT_NE(child, -1);
+    if (child == 0) {
+        spsc::SharedRingBuffer producer;
+        const char result = producer.open(name.c_str(), Role::producer) ? 1 : 0;
+        (void)::write(ready[1], &result, 1);
+        char ignored;
+        (void)::read(done[0], &ignored, 1);
+        std::_Exit(0);
+    }
+
+    char result = 0;
+    ASSERT_EQ(::read(ready[0], &result, 1), 1);
+    ASSERT_EQ(result, 1);
+
+    spsc::SharedRingBuffer producer;
+    EXPECT_FALSE(producer.open(name.c_str(), Role::producer));
+
+    ASSERT_EQ(::write(done[1], &result, 1), 1);
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_TRUE(producer.open(name.c_str(), Role::producer));
+
+    for (auto fd : {ready[0], ready[1], done[0], done[1]}) {
+        ::close(fd);
+    }
+}
+
+#endif
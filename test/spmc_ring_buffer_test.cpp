@@ -0,0 +1,262 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spmc/RingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using ReaderMode = spmc::RingBuffer::ReaderMode;
+
+TEST(SPMCRingBufferTest, Allocation) {
+    spmc::RingBuffer ring;
+    EXPECT_FALSE(ring);
+    EXPECT_FALSE(ring.addReader());
+    EXPECT_FALSE(ring.allocate(64, 0));
+
+    ASSERT_TRUE(ring.allocate(100, 2));
+    EXPECT_EQ(ring.capacity(), 128);
+    EXPECT_EQ(ring.maxReaders(), 2);
+    EXPECT_EQ(ring.freeSpace(), 128);
+
+    EXPECT_THROW(spmc::RingBuffer(1, 1), std::invalid_argument);
+    EXPECT_THROW(spmc::RingBuffer(64, 0), std::invalid_argument);
+}
+
+TEST(SPMCRingBufferTest, ReaderSlotsAreReused) {
+    spmc::RingBuffer ring(64, 2);
+
+    auto first = ring.addReader();
+    ASSERT_TRUE(first);
+    auto second = ring.addReader(ReaderMode::lossy);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(second->mode(), ReaderMode::lossy);
+    EXPECT_FALSE(ring.addReader());
+
+    first.reset();
+    auto third = ring.addReader();
+    ASSERT_TRUE(third);
+    EXPECT_TRUE(*third);
+
+    spmc::RingBuffer::Reader moved = std::move(*third);
+    EXPECT_FALSE(*third);
+    EXPECT_TRUE(moved);
+    EXPECT_FALSE(ring.addReader());
+}
+
+TEST(SPMCRingBufferTest, EveryReaderSeesEveryByte) {
+    spmc::RingBuffer ring(64, 3);
+    auto a = ring.addReader();
+    auto b = ring.addReader();
+    ASSERT_TRUE(a && b);
+
+    const std::array<int, 4> in{1, 2, 3, 4};
+    ASSERT_EQ(ring.write(std::span<const int>{in}), in.size());
+    EXPECT_EQ(a->availableBytes(), sizeof in);
+
+    // A reader added later starts at the write position
+    auto late = ring.addReader();
+    ASSERT_TRUE(late);
+    EXPECT_EQ(late->availableBytes(), 0);
+
+    for (auto *reader : {&*a, &*b}) {
+        std::array<int, 4> out{};
+        ASSERT_EQ(reader->read(std::span<int>{out}), out.size());
+        EXPECT_EQ(out, in);
+        EXPECT_EQ(reader->availableBytes(), 0);
+    }
+}
+
+TEST(SPMCRingBufferTest, SlowestBlockingReaderLimitsFreeSpace) {
+    spmc::RingBuffer ring(16, 3);
+    auto fast = ring.addReader();
+    auto slow = ring.addReader();
+    auto lossy = ring.addReader(ReaderMode::lossy);
+    ASSERT_TRUE(fast && slow && lossy);
+
+    const std::array<unsigned char, 12> data{};
+    ASSERT_EQ(ring.write(std::span<const unsigned char>{data}), data.size());
+    std::array<unsigned char, 12> out{};
+    ASSERT_EQ(fast->read(std::span<unsigned char>{out}), out.size());
+
+    EXPECT_EQ(ring.freeSpace(), 4);
+    EXPECT_EQ(ring.write(std::span<const unsigned char>{data}, false), 0);
+
+    ASSERT_EQ(slow->read(std::span<unsigned char>{out}.first(8)), 8);
+    EXPECT_EQ(ring.freeSpace(), 12);
+
+    slow.reset();
+    EXPECT_EQ(ring.freeSpace(), 16);
+}
+
+TEST(SPMCRingBufferTest, ZeroCopyReadVector) {
+    spmc::RingBuffer ring(16, 1);
+    auto reader = ring.addReader();
+    ASSERT_TRUE(reader);
+
+    // Move both positions near the end of the buffer
+    std::array<unsigned char, 12> scratch{};
+    ASSERT_EQ(ring.write(std::span<const unsigned char>{scratch}), scratch.size());
+    ASSERT_EQ(reader->read(std::span<unsigned char>{scratch}), scratch.size());
+
+    auto [front, back] = ring.writeVector(8);
+    ASSERT_EQ(front.size(), 4);
+    ASSERT_EQ(back.size(), 4);
+    std::iota(front.begin(), front.end(), 0);
+    std::iota(back.begin(), back.end(), 4);
+    ring.commitWrite(8);
+
+    auto [readFront, readBack] = reader->readVector();
+    ASSERT_EQ(readFront.size() + readBack.size(), 8);
+    EXPECT_EQ(readFront[0], 0);
+    EXPECT_EQ(readBack[3], 7);
+    EXPECT_TRUE(reader->commitRead(8));
+    EXPECT_EQ(reader->availableBytes(), 0);
+}
+
+TEST(SPMCRingBufferTest, LossyReaderIsOverrun) {
+    spmc::RingBuffer ring(16, 1);
+    auto reader = ring.addReader(ReaderMode::lossy);
+    ASSERT_TRUE(reader);
+
+    // With no blocking readers the producer never runs out of space
+    for (std::uint32_t i = 0; i < 10; ++i) {
+        ASSERT_TRUE(ring.write(i));
+    }
+
+    EXPECT_EQ(reader->availableBytes(), 16);
+    EXPECT_EQ(reader->missedBytes(), 24);
+
+    std::uint32_t value;
+    ASSERT_TRUE(reader->read(value));
+    EXPECT_EQ(value, 6);
+
+    // Data overwritten while the reader holds a read vector is rejected on commit
+    auto [front, back] = reader->readVector();
+    ASSERT_EQ(front.size() + back.size(), 12);
+    for (std::uint32_t i = 10; i < 12; ++i) {
+        ASSERT_TRUE(ring.write(i));
+    }
+    EXPECT_FALSE(reader->commitRead(12));
+    EXPECT_EQ(reader->missedBytes(), 28);
+
+    ASSERT_TRUE(reader->read(value));
+    EXPECT_EQ(value, 8);
+}
+
+TEST(SPMCRingBufferTest, LossyReaderLargeReadsWhileOverrun) {
+    spmc::RingBuffer ring(64, 1);
+    auto reader = ring.addReader(ReaderMode::lossy);
+    ASSERT_TRUE(reader);
+    constexpr std::uint64_t count = 2'000'000;
+
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            ring.write(i);
+        }
+    });
+
+    // Reads far larger than the capacity only return one intact run of consecutive values
+    bool ok = true;
+    std::vector<std::uint64_t> values(1 << 17);
+    std::uint64_t readsCompleted = 0;
+    std::uint64_t last = 0;
+    while (ok && last != count - 1) {
+        const auto itemsRead = reader->read(std::span{values});
+        if (itemsRead == 0) {
+            continue;
+        }
+        ok = itemsRead <= ring.capacity() / sizeof(std::uint64_t) && (readsCompleted == 0 || values[0] > last);
+        for (std::size_t i = 1; ok && i < itemsRead; ++i) {
+            ok = values[i] == values[i - 1] + 1;
+        }
+        ++readsCompleted;
+        last = values[itemsRead - 1];
+    }
+
+    producer.join();
+    EXPECT_TRUE(ok);
+}
+
+TEST(SPMCRingBufferTest, BroadcastProducerConsumers) {
+    spmc::RingBuffer ring(1024, 4);
+    constexpr std::uint32_t count = 200'000;
+
+    std::vector<spmc::RingBuffer::Reader> readers;
+    for (auto i = 0; i < 3; ++i) {
+        readers.push_back(std::move(*ring.addReader()));
+    }
+    auto lossy = ring.addReader(ReaderMode::lossy);
+    ASSERT_TRUE(lossy);
+
+    std::vector<std::thread> threads;
+    std::array<bool, 3> ok{};
+    for (auto i = 0; i < 3; ++i) {
+        threads.emplace_back([&reader = readers[i], &result = ok[i]] {
+            std::array<std::uint32_t, 37> buffer;
+            std::uint32_t expected = 0;
+            while (expected < count) {
+                const auto n = reader.read(std::span<std::uint32_t>{buffer});
+                for (std::size_t j = 0; j < n; ++j) {
+                    if (buffer[j] != expected++) {
+                        return;
+                    }
+                }
+                if (n == 0) {
+                    std::this_thread::yield();
+                }
+            }
+            result = true;
+        });
+    }
+
+    // A lossy reader sees every value it neither read nor skipped
+    bool lossyOk = false;
+    threads.emplace_back([&] {
+        std::uint32_t valuesRead = 0;
+        for (;;) {
+            std::uint32_t value;
+            if (!lossy->read(value)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (value != valuesRead + lossy->missedBytes() / sizeof value) {
+                return;
+            }
+            ++valuesRead;
+            if (value == count - 1) {
+                break;
+            }
+        }
+        lossyOk = true;
+    });
+
+    std::array<std::uint32_t, 53> block;
+    for (std::uint32_t n = 0; n < count;) {
+        std::iota(block.begin(), block.end(), n);
+        const auto batch = std::span<const std::uint32_t>{block}.first(std::min<std::size_t>(block.size(), count - n));
+        const auto written = ring.write(batch);
+        if (written == 0) {
+            std::this_thread::yield();
+        }
+        n += static_cast<std::uint32_t>(written);
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(ok[0] && ok[1] && ok[2]);
+    EXPECT_TRUE(lossyOk);
+}
@@ -0,0 +1,219 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/TypedRingBuffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Counts live instances to verify that elements are destroyed exactly once
+struct Tracked {
+    static inline int live = 0;
+
+    int value{0};
+
+    Tracked() noexcept { ++live; }
+    explicit Tracked(int v) noexcept : value{v} { ++live; }
+    Tracked(const Tracked &other) noexcept : value{other.value} { ++live; }
+    Tracked(Tracked &&other) noexcept : value{other.value} { ++live; }
+    Tracked &operator=(const Tracked &) noexcept = default;
+    Tracked &operator=(Tracked &&) noexcept = default;
+    ~Tracked() { --live; }
+};
+
+// Throws from its constructor on request
+struct ThrowingCopy {
+    static inline bool should_throw = false;
+
+    ThrowingCopy() = default;
+    ThrowingCopy(const ThrowingCopy &) {
+        if (should_throw) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    ThrowingCopy &operator=(const ThrowingCopy &) = default;
+};
+
+} // namespace
+
+TEST(TypedRingBufferTest, DynamicCapacity) {
+    spsc::TypedRingBuffer<int> rb;
+    EXPECT_FALSE(rb);
+    EXPECT_EQ(rb.capacity(), 0);
+    EXPECT_FALSE(rb.write(1));
+    EXPECT_FALSE(rb.read().has_value());
+
+    EXPECT_FALSE(rb.allocate(1));
+    ASSERT_TRUE(rb.allocate(100));
+    EXPECT_TRUE(rb);
+    EXPECT_EQ(rb.capacity(), 128);
+    EXPECT_EQ(rb.freeSpace(), 128);
+    EXPECT_TRUE(rb.isEmpty());
+
+    EXPECT_THROW(spsc::TypedRingBuffer<int>{1}, std::invalid_argument);
+}
+
+TEST(TypedRingBufferTest, StaticCapacity) {
+    spsc::TypedRingBuffer<std::uint64_t, 8> rb;
+    static_assert(decltype(rb)::hasStaticCapacity);
+    EXPECT_TRUE(rb);
+    EXPECT_EQ(rb.capacity(), 8);
+
+    for (std::uint64_t i = 0; i < 8; ++i) {
+        EXPECT_TRUE(rb.write(i));
+    }
+    EXPECT_TRUE(rb.isFull());
+    EXPECT_FALSE(rb.write(std::uint64_t{8}));
+
+    for (std::uint64_t i = 0; i < 8; ++i) {
+        auto value = rb.read();
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_TRUE(rb.isEmpty());
+}
+
+TEST(TypedRingBufferTest, MoveOnlyElements) {
+    spsc::TypedRingBuffer<std::unique_ptr<int>, 4> rb;
+
+    auto p = std::make_unique<int>(42);
+    EXPECT_TRUE(rb.write(std::move(p)));
+    EXPECT_EQ(p, nullptr);
+    EXPECT_TRUE(rb.emplace(std::make_unique<int>(7)));
+
+    ASSERT_NE(rb.front(), nullptr);
+    EXPECT_EQ(**rb.front(), 42);
+
+    std::unique_ptr<int> out;
+    EXPECT_TRUE(rb.read(out));
+    EXPECT_EQ(*out, 42);
+
+    auto next = rb.read();
+    ASSERT_TRUE(next.has_value());
+    EXPECT_EQ(**next, 7);
+    EXPECT_EQ(rb.front(), nullptr);
+}
+
+TEST(TypedRingBufferTest, ElementsAreDestroyed) {
+    Tracked::live = 0;
+    {
+        spsc::TypedRingBuffer<Tracked> rb{8};
+        for (int i = 0; i < 6; ++i) {
+            EXPECT_TRUE(rb.emplace(i));
+        }
+        EXPECT_EQ(Tracked::live, 6);
+
+        EXPECT_EQ(rb.skip(2), 2);
+        EXPECT_EQ(Tracked::live, 4);
+
+        Tracked out;
+        EXPECT_TRUE(rb.read(out));
+        EXPECT_EQ(out.value, 2);
+        EXPECT_EQ(Tracked::live, 4);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+
+    {
+        spsc::TypedRingBuffer<Tracked, 4> rb;
+        EXPECT_TRUE(rb.emplace(1));
+        EXPECT_TRUE(rb.emplace(2));
+        EXPECT_EQ(rb.drain(), 2);
+        EXPECT_EQ(Tracked::live, 0);
+        EXPECT_TRUE(rb.emplace(3));
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+TEST(TypedRingBufferTest, SpanWriteReadWrapsAround) {
+    spsc::TypedRingBuffer<int, 8> rb;
+
+    std::array<int, 6> first{1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(rb.write(std::span<const int>{first}), 6);
+    EXPECT_EQ(rb.skip(4), 4);
+
+    std::array<int, 8> second{7, 8, 9, 10, 11, 12, 13, 14};
+    EXPECT_EQ(rb.write(std::span<const int>{second}, false), 0);
+    EXPECT_EQ(rb.write(std::span<const int>{second}), 6);
+
+    std::array<int, 8> out{};
+    EXPECT_EQ(rb.read(std::span<int>{out}), 8);
+    EXPECT_EQ(out, (std::array<int, 8>{5, 6, 7, 8, 9, 10, 11, 12}));
+}
+
+TEST(TypedRingBufferTest, SpanOfNonTrivialElements) {
+    spsc::TypedRingBuffer<std::string, 4> rb;
+
+    std::array<std::string, 3> in{"one", "two", "three"};
+    EXPECT_EQ(rb.write(std::span<const std::string>{in}), 3);
+
+    std::array<std::string, 3> out;
+    EXPECT_EQ(rb.read(std::span<std::string>{out}, false), 3);
+    EXPECT_EQ(out, in);
+}
+
+TEST(TypedRingBufferTest, FailedCopyLeavesBufferUnchanged) {
+    spsc::TypedRingBuffer<ThrowingCopy, 4> rb;
+    ThrowingCopy value;
+
+    ThrowingCopy::should_throw = true;
+    EXPECT_THROW(rb.write(value), std::runtime_error);
+    ThrowingCopy::should_throw = false;
+
+    EXPECT_TRUE(rb.isEmpty());
+    EXPECT_TRUE(rb.write(value));
+    EXPECT_EQ(rb.size(), 1);
+}
+
+TEST(TypedRingBufferTest, MoveConstruction) {
+    spsc::TypedRingBuffer<int> rb{4};
+    EXPECT_TRUE(rb.write(5));
+
+    spsc::TypedRingBuffer<int> other{std::move(rb)};
+    EXPECT_FALSE(rb);
+    EXPECT_EQ(other.size(), 1);
+    EXPECT_EQ(other.read(), 5);
+}
+
+TEST(TypedRingBufferTest, SPSCStressTestMoveOnly) {
+    constexpr int iterations = 200'000;
+    spsc::TypedRingBuffer<std::unique_ptr<int>, 256> rb;
+
+    std::thread producer([&] {
+        for (int i = 0; i < iterations;) {
+            if (rb.emplace(std::make_unique<int>(i))) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::thread consumer([&] {
+        for (int expected = 0; expected < iterations;) {
+            if (auto value = rb.read(); value) {
+                ASSERT_EQ(**value, expected);
+                ++expected;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+
+    EXPECT_TRUE(rb.isEmpty());
+}
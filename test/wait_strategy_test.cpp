@@ -0,0 +1,102 @@
+//
+// SPDX-FileCopyrightText: 2025 Stephen F. Booth <contact@sbooth.dev>
+// SPDX-License-Identifier: MIT
+//
+// Part of https://github.com/sbooth/CXXRingBuffer
+//
+
+#include "spsc/RingBuffer.hpp"
+#include "spsc/WaitStrategy.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+TEST(WaitStrategyTest, Phases) {
+    EXPECT_EQ(spsc::ParkWait{}.phase(0), spsc::WaitPhase::park);
+    EXPECT_EQ(spsc::BusySpinWait{}.phase(1'000'000), spsc::WaitPhase::spin);
+
+    constexpr spsc::SpinYieldWait spinYield{.spinCount = 2};
+    static_assert(spinYield.phase(1) == spsc::WaitPhase::spin);
+    static_assert(spinYield.phase(2) == spsc::WaitPhase::yield);
+
+    constexpr spsc::SpinThenParkWait spinThenPark{.spinCount = 2, .yieldCount = 3};
+    static_assert(spinThenPark.phase(0) == spsc::WaitPhase::spin);
+    static_assert(spinThenPark.phase(2) == spsc::WaitPhase::yield);
+    static_assert(spinThenPark.phase(4) == spsc::WaitPhase::yield);
+    static_assert(spinThenPark.phase(5) == spsc::WaitPhase::park);
+}
+
+TEST(WaitStrategyTest, CountersRecordPhases) {
+    spsc::RingBuffer rb(64);
+    spsc::SpinThenParkWait strategy{.spinCount = 4, .yieldCount = 2};
+
+    EXPECT_FALSE(rb.readFor<std::uint32_t>(std::chrono::milliseconds{20}, strategy));
+    EXPECT_EQ(strategy.counters.spins, 4);
+    EXPECT_EQ(strategy.counters.yields, 2);
+    EXPECT_GE(strategy.counters.parks, 1);
+}
+
+TEST(WaitStrategyTest, BusySpinNeverParks) {
+    spsc::RingBuffer rb(64);
+    spsc::BusySpinWait strategy;
+
+    std::thread producer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        rb.write(std::uint32_t{5});
+    });
+
+    // The producer does not notify, which is harmless because the consumer never parks
+    std::uint32_t value = 0;
+    EXPECT_TRUE(rb.readWait(value, strategy));
+    EXPECT_EQ(value, 5);
+    EXPECT_GT(strategy.counters.spins, 0);
+    EXPECT_EQ(strategy.counters.parks, 0);
+    producer.join();
+}
+
+TEST(WaitStrategyTest, SpinThenParkProducerConsumer) {
+    spsc::RingBuffer rb(128);
+    constexpr std::uint64_t count = 200'000;
+
+    spsc::SpinThenParkWait producerStrategy{.spinCount = 64, .yieldCount = 4};
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < count; ++i) {
+            ASSERT_TRUE(rb.writeWait(i, producerStrategy));
+        }
+    });
+
+    spsc::SpinThenParkWait consumerStrategy{.spinCount = 64, .yieldCount = 4};
+    for (std::uint64_t i = 0; i < count; ++i) {
+        std::uint64_t value = 0;
+        ASSERT_TRUE(rb.readWait(value, consumerStrategy));
+        ASSERT_EQ(value, i);
+    }
+
+    producer.join();
+    EXPECT_TRUE(rb.isEmpty());
+}
+
+TEST(WaitStrategyTest, ReadBatchWaitCommitsBeforeBlocking) {
+    spsc::RingBuffer rb(16);
+    ASSERT_TRUE(rb.writeAll(std::uint64_t{1}, std::uint64_t{2}));
+
+    std::thread producer([&] {
+        // Only fits once the consumer commits the first value
+        EXPECT_TRUE(rb.writeWait(std::uint64_t{3}));
+    });
+
+    spsc::RingBuffer::ReadBatch batch(rb);
+    std::uint64_t value = 0;
+    ASSERT_TRUE(batch.read(value));
+    ASSERT_TRUE(batch.read(value));
+    EXPECT_EQ(value, 2);
+
+    EXPECT_FALSE(batch.wait(17));
+    EXPECT_TRUE(batch.wait(sizeof value, spsc::SpinThenParkWait{}));
+    ASSERT_TRUE(batch.read(value));
+    EXPECT_EQ(value, 3);
+    producer.join();
+}